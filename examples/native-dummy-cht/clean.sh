@@ -0,0 +1,10 @@
+#!/usr/bin/env sh
+set -e -u
+
+# Remove the files written by run.sh.
+
+cd "$(dirname "$0")"
+rm -rf precice-run precice-profiling ./*.log
+cd fluid-su2
+rm -f channel.su2 ./*.vtu ./*.pvd ./*.dat ./*.csv ./*.log precice-*.json checkpoint*
+rm -rf vol_solution surface_solution
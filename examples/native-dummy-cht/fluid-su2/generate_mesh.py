@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+## \file generate_mesh.py
+#  \brief Write the structured 2D channel mesh (channel.su2) of the dummy CHT case.
+#
+# Part of the SU2-preCICE adapter: https://github.com/precice/su2-adapter
+# This adapter is distributed under the GNU Lesser General Public
+# License (see LICENSE file).
+
+nx, ny = 40, 10         # Number of cells along and across the channel
+length, height = 1.0, 0.1
+
+def point(i, j):
+    return j*(nx + 1) + i
+
+with open("channel.su2", "w") as mesh:
+    mesh.write("NDIME= 2\n")
+
+    # Quadrilaterals (VTK type 9)
+    mesh.write("NELEM= {}\n".format(nx*ny))
+    for j in range(ny):
+        for i in range(nx):
+            mesh.write("9 {} {} {} {} {}\n".format(point(i, j), point(i + 1, j), point(i + 1, j + 1), point(i, j + 1), j*nx + i))
+
+    mesh.write("NPOIN= {}\n".format((nx + 1)*(ny + 1)))
+    for j in range(ny + 1):
+        for i in range(nx + 1):
+            mesh.write("{:.8f} {:.8f} {}\n".format(i*length/nx, j*height/ny, point(i, j)))
+
+    # Lines (VTK type 3), the heated wall at the bottom is the coupling interface
+    markers = {
+        "interface": [(point(i, 0), point(i + 1, 0)) for i in range(nx)],
+        "top": [(point(i + 1, ny), point(i, ny)) for i in range(nx)],
+        "inlet": [(point(0, j + 1), point(0, j)) for j in range(ny)],
+        "outlet": [(point(nx, j), point(nx, j + 1)) for j in range(ny)],
+    }
+    mesh.write("NMARK= {}\n".format(len(markers)))
+    for tag, lines in markers.items():
+        mesh.write("MARKER_TAG= {}\n".format(tag))
+        mesh.write("MARKER_ELEMS= {}\n".format(len(lines)))
+        for line in lines:
+            mesh.write("3 {} {}\n".format(*line))
@@ -0,0 +1,25 @@
+#!/usr/bin/env sh
+set -e -u
+
+# Run the fluid participant, with the C++ coupling loop (default) or with the Python script (./run.sh python).
+# Optional number of MPI ranks as second argument, e.g. ./run.sh native 4
+
+cd "$(dirname "$0")"
+python3 generate_mesh.py
+
+loop="${1:-native}"
+ranks="${2:-1}"
+
+if [ "$loop" = "python" ]; then
+    if [ "$ranks" -gt 1 ]; then
+        mpirun -n "$ranks" python3 "${SU2_RUN}/SU2_preCICE_CHT.py" -f laminar_channel.cfg --parallel
+    else
+        python3 "${SU2_RUN}/SU2_preCICE_CHT.py" -f laminar_channel.cfg
+    fi
+else
+    if [ "$ranks" -gt 1 ]; then
+        mpirun -n "$ranks" SU2_preCICE laminar_channel.cfg precice-adapter.cfg
+    else
+        SU2_preCICE laminar_channel.cfg precice-adapter.cfg
+    fi
+fi
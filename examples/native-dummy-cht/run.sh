@@ -0,0 +1,18 @@
+#!/usr/bin/env sh
+set -e -u
+
+# Run both participants of the dummy CHT case, the arguments are passed to fluid-su2/run.sh:
+#   ./run.sh               C++ coupling loop of SU2_preCICE
+#   ./run.sh python        Python coupling loop of SU2_preCICE_CHT.py
+#   ./run.sh native 4      C++ coupling loop on 4 MPI ranks
+
+cd "$(dirname "$0")"
+rm -rf precice-run
+
+./solid-dummy/run.sh > solid-dummy.log 2>&1 &
+dummy=$!
+
+./fluid-su2/run.sh "$@" 2>&1 | tee fluid-su2.log
+wait "$dummy"
+
+echo "Fluid output in fluid-su2.log, solid dummy output in solid-dummy.log"
@@ -0,0 +1,7 @@
+#!/usr/bin/env sh
+set -e -u
+
+# Run the dummy solid participant, it requires the preCICE Python bindings (pip install pyprecice).
+
+cd "$(dirname "$0")"
+python3 solverdummy.py
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+## \file solverdummy.py
+#  \brief Dummy solid participant of the CHT case: it writes a fixed wall temperature and reports the heat flux it reads.
+#
+# Part of the SU2-preCICE adapter: https://github.com/precice/su2-adapter
+# This adapter is distributed under the GNU Lesser General Public
+# License (see LICENSE file).
+
+import numpy
+import precice
+
+wall_temperature = 310.0      # Constant temperature of the solid at the interface [K]
+nx, length = 40, 1.0          # Same vertices as the interface of fluid-su2/generate_mesh.py
+
+participant = precice.Participant("Solid", "../precice-config.xml", 0, 1)
+
+vertices = numpy.zeros((nx + 1, 2))
+vertices[:, 0] = numpy.linspace(0.0, length, nx + 1)
+vertex_ids = participant.set_mesh_vertices("Solid-Mesh", vertices)
+temperature = numpy.full(nx + 1, wall_temperature)
+
+if participant.requires_initial_data():
+    participant.write_data("Solid-Mesh", "Temperature", vertex_ids, temperature)
+
+participant.initialize()
+
+while participant.is_coupling_ongoing():
+    if participant.requires_writing_checkpoint():
+        pass  # The dummy has no state
+
+    dt = participant.get_max_time_step_size()
+    heat_flux = participant.read_data("Solid-Mesh", "Heat-Flux", vertex_ids, dt)
+    print("Solid dummy: heat flux min {:.6g}, max {:.6g}, mean {:.6g} W/m^2".format(
+        heat_flux.min(), heat_flux.max(), heat_flux.mean()))
+
+    participant.write_data("Solid-Mesh", "Temperature", vertex_ids, temperature)
+    participant.advance(dt)
+
+    if participant.requires_reading_checkpoint():
+        pass
+
+participant.finalize()
@@ -40,6 +40,8 @@
 
 //preCICE: include required header file for MatrixType
 #include "../../../Common/include/containers/container_decorators.hpp"
+//preCICE: include required header file for the asynchronous checkpoint
+#include <future>
 
 using namespace std;
 
@@ -107,22 +109,168 @@ protected:
 
   // preCICE:
   using MatrixType = C2DContainer<unsigned long, su2double, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
-  MatrixType preCICE_Solution;                  /*!< \brief FLOW Solution of the problem - for preCICE implicit coupling. */
-  MatrixType preCICE_Solution_time_n;           /*!< \brief FLOW Solution of the problem at time n for dual-time stepping technique - for preCICE implicit coupling. */
-  MatrixType preCICE_Solution_time_n1;          /*!< \brief FLOW Solution of the problem at time n-1 for dual-time stepping technique - for preCICE implicit coupling. */
-  MatrixType preCICE_TURB_Solution;             /*!< \brief TURB Solution of the problem - for preCICE implicit coupling. */
-  MatrixType preCICE_TURB_Solution_time_n;      /*!< \brief TURB Solution of the problem at time n for dual-time stepping technique - for preCICE implicit coupling. */
-  MatrixType preCICE_TURB_Solution_time_n1;     /*!< \brief TURB Solution of the problem at time n-1 for dual-time stepping technique - for preCICE implicit coupling. */
-  MatrixType preCICE_MESH_Solution;             /*!< \brief MESH Solution of the problem - for preCICE implicit coupling. */
-  MatrixType preCICE_MESH_Solution_time_n;      /*!< \brief MESH Solution of the problem at time n for dual-time stepping technique - for preCICE implicit coupling. */
-  MatrixType preCICE_MESH_Solution_time_n1;     /*!< \brief MESHSolution of the problem at time n-1 for dual-time stepping technique - for preCICE implicit coupling. */
-
-  
-  su2activematrix preCICE_Coord;                /*!< \brief vector with the coordinates of the node - for preCICE implicit coupling. */
-  su2activematrix preCICE_GridVel;              /*!< \brief Velocity of the grid for dynamic mesh cases - for preCICE implicit coupling. */
-  su2activevector preCICE_Volume;               /*!< \brief Volume or Area of the control volume in 3D and 2D - for preCICE implicit coupling. */
-  su2activevector preCICE_Volume_n;             /*!< \brief Volume at time n - for preCICE implicit coupling. */
-  su2activevector preCICE_Volume_nM1;           /*!< \brief Volume at time n-1 - for preCICE implicit coupling. */
+  using SingleMatrixType = C2DContainer<unsigned long, float, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
+
+  /*!
+   * \brief Field of the state saved for preCICE implicit coupling, stored in working or single precision.
+   */
+  struct CPreciceCheckpointBuffer {
+    MatrixType Double;                          /*!< \brief Values in working precision. */
+    SingleMatrixType Single;                    /*!< \brief Values in single precision. */
+    vector<vector<uint8_t> > Blocks;            /*!< \brief Losslessly compressed blocks of BlockSize points. */
+    bool IsSingle = false;                      /*!< \brief Whether the values are stored in single precision. */
+    bool IsCompressed = false;                  /*!< \brief Whether the values are stored in compressed blocks. */
+    unsigned long nPoint = 0;                   /*!< \brief Number of points. */
+    unsigned long nVar = 0;                     /*!< \brief Number of values per point. */
+    passivedouble MaxError = 0.0;               /*!< \brief Largest round-trip error of the last save (single precision only). */
+
+    static constexpr unsigned long BlockSize = 1024;  /*!< \brief Number of points per compressed block. */
+
+    /*!
+     * \brief Allocate the storage.
+     * \param[in] val_nPoint - Number of points.
+     * \param[in] val_nVar - Number of values per point.
+     * \param[in] single - Whether to store in single precision.
+     * \param[in] compressed - Whether to store in compressed blocks (the blocks grow to their size at the first saves).
+     */
+    void resize(unsigned long val_nPoint, unsigned long val_nVar, bool single, bool compressed = false) {
+      nPoint = val_nPoint;
+      nVar = val_nVar;
+      IsSingle = single;
+      IsCompressed = compressed;
+      if (IsCompressed) Blocks.resize((nPoint + BlockSize - 1) / BlockSize);
+      else if (IsSingle) Single.resize(nPoint, nVar);
+      else Double.resize(nPoint, nVar);
+    }
+
+    /*!
+     * \brief Whether another field is stored in the same way, i.e. their buffers can be exchanged.
+     */
+    bool SameStorage(const CPreciceCheckpointBuffer& other) const {
+      return (IsSingle == other.IsSingle) && (IsCompressed == other.IsCompressed);
+    }
+
+    /*!
+     * \brief Store one value.
+     * \return Round-trip error of the value.
+     */
+    passivedouble Set(unsigned long iPoint, unsigned long iVar, const su2double& val) {
+      if (!IsSingle) {
+        Double(iPoint, iVar) = val;
+        return 0.0;
+      }
+      Single(iPoint, iVar) = SU2_TYPE::GetValue(val);
+      return fabs(SU2_TYPE::GetValue(val) - Single(iPoint, iVar));
+    }
+
+    /*!
+     * \brief Get one stored value.
+     */
+    su2double Get(unsigned long iPoint, unsigned long iVar) const {
+      return IsSingle ? su2double(Single(iPoint, iVar)) : Double(iPoint, iVar);
+    }
+  };
+
+  /*!
+   * \brief Solution levels of a solver saved for preCICE implicit coupling, stored in working precision.
+   */
+  struct CPreciceSolverLevels {
+    CPreciceCheckpointBuffer Solution;          /*!< \brief Solution of the solver. */
+    CPreciceCheckpointBuffer Solution_time_n;   /*!< \brief Solution of the solver at time n for dual-time stepping technique. */
+    CPreciceCheckpointBuffer Solution_time_n1;  /*!< \brief Solution of the solver at time n-1 for dual-time stepping technique. */
+    bool Solution_time_n_IsSolution = false;    /*!< \brief Solution at time n was equal to the Solution when saved and is not stored. */
+  };
+
+  /*!
+   * \brief State saved for preCICE implicit coupling, tagged with its time window and time iteration.
+   */
+  struct CPreciceCheckpoint {
+    unsigned long TimeWindow = 0;               /*!< \brief Time window (number of previous saves) of the saved state. */
+    unsigned long TimeIter = 0;                 /*!< \brief Time iteration that runs next from the saved state. */
+
+    CPreciceCheckpointBuffer Solution;          /*!< \brief FLOW Solution of the problem. */
+    CPreciceCheckpointBuffer Solution_time_n;   /*!< \brief FLOW Solution of the problem at time n for dual-time stepping technique. */
+    CPreciceCheckpointBuffer Solution_time_n1;  /*!< \brief FLOW Solution of the problem at time n-1 for dual-time stepping technique. */
+    CPreciceCheckpointBuffer TURB_Solution;     /*!< \brief TURB Solution of the problem. */
+    CPreciceCheckpointBuffer TURB_Solution_time_n;  /*!< \brief TURB Solution of the problem at time n for dual-time stepping technique. */
+    CPreciceCheckpointBuffer TURB_Solution_time_n1; /*!< \brief TURB Solution of the problem at time n-1 for dual-time stepping technique. */
+    CPreciceCheckpointBuffer MESH_Solution;     /*!< \brief MESH Solution of the problem. */
+    CPreciceCheckpointBuffer MESH_Solution_time_n;  /*!< \brief MESH Solution of the problem at time n for dual-time stepping technique. */
+    CPreciceCheckpointBuffer MESH_Solution_time_n1; /*!< \brief MESH Solution of the problem at time n-1 for dual-time stepping technique. */
+
+    vector<CPreciceSolverLevels> SCALAR;        /*!< \brief Solution levels of the other active solvers (e.g. species, transition), in the order of preCICE_ScalarSolvers. */
+
+    CPreciceCheckpointBuffer Coord;             /*!< \brief vector with the coordinates of the node. */
+    CPreciceCheckpointBuffer GridVel;           /*!< \brief Velocity of the grid for dynamic mesh cases. */
+    CPreciceCheckpointBuffer Volume;            /*!< \brief Volume or Area of the control volume in 3D and 2D. */
+    CPreciceCheckpointBuffer Volume_n;          /*!< \brief Volume at time n. */
+    CPreciceCheckpointBuffer Volume_nM1;        /*!< \brief Volume at time n-1. */
+
+    vector<CPreciceCheckpointBuffer> MG_Solution;         /*!< \brief FLOW Solution of the coarse multigrid levels, including halos. */
+    vector<CPreciceCheckpointBuffer> MG_Solution_time_n;  /*!< \brief FLOW Solution at time n of the coarse multigrid levels, including halos. */
+    vector<CPreciceCheckpointBuffer> MG_Solution_time_n1; /*!< \brief FLOW Solution at time n-1 of the coarse multigrid levels, including halos. */
+    vector<CPreciceCheckpointBuffer> MG_TURB_Solution;    /*!< \brief TURB Solution of the coarse multigrid levels, including halos. */
+    vector<CPreciceCheckpointBuffer> MG_TURB_muT;         /*!< \brief Eddy viscosity of the coarse multigrid levels, including halos. */
+
+    vector<CPreciceCheckpointBuffer> Metrics_Coord;         /*!< \brief Coordinates of the multigrid levels (not stored for the fine level), including halos. */
+    vector<CPreciceCheckpointBuffer> Metrics_Volume;        /*!< \brief Control volumes of all multigrid levels, including halos. */
+    vector<CPreciceCheckpointBuffer> Metrics_Edge_Normal;   /*!< \brief Dual-grid edge normals of all multigrid levels. */
+    vector<CPreciceCheckpointBuffer> Metrics_Vertex_Normal; /*!< \brief Boundary vertex normals of all multigrid levels, marker after marker. */
+    CPreciceCheckpointBuffer Metrics_MaxLength;             /*!< \brief Maximum cell-center to cell-center length of the fine level, including halos. */
+
+    bool Solution_time_n_IsSolution = false;      /*!< \brief FLOW Solution at time n was equal to the Solution when saved and is not stored. */
+    bool TURB_Solution_time_n_IsSolution = false; /*!< \brief TURB Solution at time n was equal to the Solution when saved and is not stored. */
+    bool MESH_Solution_time_n_IsSolution = false; /*!< \brief MESH Solution at time n was equal to the Solution when saved and is not stored. */
+    bool Volume_n_IsVolume = false;               /*!< \brief Volume at time n was equal to the Volume when saved and is not stored. */
+  };
+
+  vector<unsigned short> preCICE_ScalarSolvers;         /*!< \brief Active solvers besides FLOW, TURB and MESH, saved in CPreciceCheckpoint::SCALAR - for preCICE implicit coupling. */
+  vector<CPreciceCheckpoint> preCICE_Checkpoints;       /*!< \brief Ring of saved states, allocated at the first save - for preCICE implicit coupling. */
+  unsigned short preCICE_nCheckpoint = 1;               /*!< \brief Number of states kept in the ring - for preCICE implicit coupling. */
+  unsigned short preCICE_nCheckpoint_Saved = 0;         /*!< \brief Number of states of the ring that can be reloaded - for preCICE implicit coupling. */
+  unsigned short preCICE_Checkpoint_Last = 0;           /*!< \brief Position of the most recent state in the ring - for preCICE implicit coupling. */
+  map<string, bool> preCICE_CheckpointCompressed;       /*!< \brief Fields of the saved state stored compressed - for preCICE implicit coupling. */
+  map<string, bool> preCICE_CheckpointSingle;           /*!< \brief Fields of the saved state stored in single precision - for preCICE implicit coupling. */
+  bool preCICE_CheckpointHalo = false;                  /*!< \brief Save the solution levels of the halo points as well - for preCICE implicit coupling. */
+  bool preCICE_Checkpoint_WithHalo = false;             /*!< \brief Whether the allocated checkpoints include the halo points - for preCICE implicit coupling. */
+  bool preCICE_CheckpointMultigrid = false;             /*!< \brief Save the coarse multigrid levels instead of restricting the solution on reload - for preCICE implicit coupling. */
+  bool preCICE_CheckpointMinimal = false;               /*!< \brief Derive the coordinates, grid velocity and volume on reload instead of storing them - for preCICE implicit coupling. */
+  bool preCICE_CheckpointVerify = false;                /*!< \brief Also store the derived fields and compare them on reload - for preCICE implicit coupling. */
+  vector<passivedouble> preCICE_CheckpointVerifyError = {0.0, 0.0}; /*!< \brief Largest difference of the derived coordinates and volume at the last reload - for preCICE implicit coupling. */
+  bool preCICE_CheckpointMetrics = false;               /*!< \brief Save the dual-grid metrics instead of rebuilding them on reload - for preCICE implicit coupling. */
+  vector<passivedouble> preCICE_CheckpointGeometryTime = {0.0, 0.0}; /*!< \brief Time to restore the geometry at the last reload and to rebuild it at the last full update - for preCICE implicit coupling. */
+  bool preCICE_CheckpointSwap = false;                  /*!< \brief Rewind the FLOW Solution by swapping buffers instead of copying - for preCICE implicit coupling. */
+  string preCICE_CheckpointFile;                        /*!< \brief File of this rank the checkpoints are written to, empty if not written - for preCICE implicit coupling. */
+  future<string> preCICE_CheckpointFile_Pending;        /*!< \brief Write of the last checkpoint file, returns an error message - for preCICE implicit coupling. */
+  mutable future<string> preCICE_SaveOldState_Pending;  /*!< \brief Save running on a helper thread since StartSaveOldState, returns an error message - for preCICE implicit coupling. */
+  bool preCICE_CopyOnWrite_Pending = false;             /*!< \brief The FLOW Solution buffer holds the checkpoint, which must be copied before it is modified - for preCICE implicit coupling. */
+  vector<vector<uint8_t> > preCICE_CheckpointScratch;  /*!< \brief Scratch buffer of each thread to compress the checkpoint blocks, kept between saves - for preCICE implicit coupling. */
+
+  mutable const CGeometry* preCICE_VertexCache_Geometry = nullptr;  /*!< \brief Geometry for which the vertex lists below were built - for preCICE. */
+  mutable vector<unsigned long> preCICE_VertexCache_nVertex;         /*!< \brief Number of vertices of each marker when the lists below were built - for preCICE. */
+  mutable vector<vector<unsigned long> > preCICE_PhysicalVertices;   /*!< \brief Physical (non-halo) vertices of each marker - for preCICE. */
+  mutable vector<vector<unsigned long> > preCICE_PhysicalPoints;     /*!< \brief Points of the physical vertices of each marker - for preCICE. */
+  const CGeometry* preCICE_DeformCache_Geometry = nullptr;          /*!< \brief Geometry for which the list below was built - for preCICE. */
+  vector<unsigned long> preCICE_DeformPoints;                        /*!< \brief Points of the deforming and moving markers, each listed once - for preCICE. */
+
+  /*!
+   * \brief Kind of data read or written on a marker by RunCouplingStep - for preCICE.
+   */
+  enum class PRECICE_DATA { NONE, DISPLACEMENT, FORCE, TEMPERATURE, HEAT_FLUX };
+
+  /*!
+   * \brief Marker of the coupling interface and the data exchanged on it by RunCouplingStep - for preCICE.
+   */
+  struct CPreciceCouplingMarker {
+    unsigned short Marker;                      /*!< \brief Marker identifier. */
+    PRECICE_DATA Read;                          /*!< \brief Data set on the marker before the time iteration. */
+    PRECICE_DATA Write;                         /*!< \brief Data got from the marker after the time iteration. */
+    unsigned short nRead;                       /*!< \brief Number of read values per vertex. */
+    unsigned short nWrite;                      /*!< \brief Number of write values per vertex. */
+  };
+
+  vector<CPreciceCouplingMarker> preCICE_CouplingMarkers;  /*!< \brief Markers of RunCouplingStep, in the order of its buffers - for preCICE. */
+  vector<passivedouble> preCICE_CouplingWriteData;         /*!< \brief Write data of the last RunCouplingStep called with a vector - for preCICE. */
 
 public:
 
@@ -382,6 +530,174 @@ protected:
    */
    void FinalizeMESH_SOL();
 
+  /*!
+   * \brief Finalize reloading another active solver (e.g. SPECIES_SOL, TRANS_SOL), for preCICE implicit coupling
+   * Precondition: SaveOldState called first
+   * \param[in] iSol - Position of the solver in the solver container.
+   */
+  void FinalizeSCALAR_SOL(unsigned short iSol);
+
+  /*!
+   * \brief Get the points of the deforming and moving markers, each listed once, for preCICE implicit coupling.
+   * The list is built at the first call for the current geometry.
+   */
+  const vector<unsigned long>& GetDeformMarkerPoints();
+
+  /*!
+   * \brief Save the time levels of one solver, for preCICE implicit coupling.
+   * The level n is not stored if it equals the solution, and the level n-1 is taken over from the
+   * previous save if exactly one dual-time update happened since then.
+   * \param[in] nodes - Variables of the solver.
+   * \param[in] nVar - Number of variables of the solver.
+   * \param[in] shift - Whether the level n of the previous save is now the level n-1.
+   * \param[in] aliased - Whether the level n equals the solution, i.e. the dual-time update ran last.
+   * \param[in,out] Solution - Saved solution.
+   * \param[in,out] Solution_time_n - Saved solution at time n.
+   * \param[in,out] Solution_time_n1 - Saved solution at time n-1.
+   * \param[in,out] time_n_IsSolution - Whether the saved solution at time n is Solution.
+   */
+  void SaveSolutionLevels(CVariable* nodes, unsigned short nVar, bool shift, bool aliased,
+                          CPreciceCheckpointBuffer& Solution, CPreciceCheckpointBuffer& Solution_time_n,
+                          CPreciceCheckpointBuffer& Solution_time_n1, bool& time_n_IsSolution);
+
+  /*!
+   * \brief Copy a contiguous block into a checkpoint field, for preCICE implicit coupling.
+   * Must be called by all threads of a parallel region, MaxError must be reset before, and the scratch buffers
+   * must be allocated for all threads (see ResizeCheckpointScratch).
+   * \param[in] size - Number of values.
+   * \param[in] src - Values to save.
+   * \param[in,out] buffer - Checkpoint field.
+   */
+  void SaveCheckpointBuffer(unsigned long size, const su2double* src, CPreciceCheckpointBuffer& buffer);
+
+  /*!
+   * \brief Copy a checkpoint field into a contiguous block, for preCICE implicit coupling.
+   * Must be called by all threads of a parallel region, after ResizeCheckpointScratch.
+   * \param[in] size - Number of values.
+   * \param[in] buffer - Checkpoint field.
+   * \param[out] dst - Restored values.
+   */
+  void LoadCheckpointBuffer(unsigned long size, const CPreciceCheckpointBuffer& buffer, su2double* dst);
+
+  /*!
+   * \brief Allocate a compression scratch buffer for every thread, for preCICE implicit coupling.
+   * The buffers keep their capacity, so that the blocks of later saves and reloads do not allocate.
+   */
+  void ResizeCheckpointScratch();
+
+  /*!
+   * \brief Copy a checkpoint swapped out by ReloadOldState back before a save, if the save does not overwrite it,
+   * i.e. if the ring has more than one checkpoint, for preCICE implicit coupling.
+   */
+  void KeepSwappedOldState();
+
+  /*!
+   * \brief Copy the state into the next checkpoint of the ring, for preCICE implicit coupling.
+   * Called by SaveOldState, or on a helper thread by StartSaveOldState, after the checkpoint file of the previous
+   * save was waited for. It makes no MPI calls and raises no SU2 errors, so that it can run on the helper thread.
+   * \param[in] TimeIter - Time iteration that runs next from the saved state.
+   */
+  void StoreOldState(unsigned long TimeIter);
+
+  /*!
+   * \brief Get all buffers of a saved state in a fixed order, for the checkpoint files of preCICE implicit coupling.
+   * \param[in] checkpoint - Saved state.
+   * \return Pointers to the buffers, including those of all multigrid levels.
+   */
+  static vector<CPreciceCheckpointBuffer*> GetCheckpointBuffers(CPreciceCheckpoint& checkpoint);
+
+  /*!
+   * \brief Write a saved state as a raw binary file, for preCICE implicit coupling. The state is not modified.
+   * The file is first written as filename.tmp and renamed when it is complete. Runs on a helper thread.
+   * \param[in] checkpoint - Saved state.
+   * \param[in] filename - Name of the file.
+   * \return Error message, empty on success.
+   */
+  static string WriteCheckpointFile(CPreciceCheckpoint& checkpoint, const string& filename);
+
+  /*!
+   * \brief Read a saved state from a file written by WriteCheckpointFile, for preCICE implicit coupling.
+   * \param[in,out] checkpoint - Saved state, allocated with the settings the file was written with.
+   * \param[in] filename - Name of the file.
+   * \return Error message, empty on success.
+   */
+  static string ReadCheckpointFile(CPreciceCheckpoint& checkpoint, const string& filename);
+
+  /*!
+   * \brief Wait for the checkpoint file being written, for preCICE implicit coupling. Does nothing otherwise.
+   */
+  void WaitCheckpointFile();
+
+  /*!
+   * \brief Save the dual-grid metrics of all multigrid levels, i.e. everything CGeometry::UpdateGeometry computes
+   * from the coordinates, for preCICE implicit coupling.
+   * \param[in,out] checkpoint - Saved state.
+   */
+  void SaveGeometryMetrics(CPreciceCheckpoint& checkpoint);
+
+  /*!
+   * \brief Restore the dual-grid metrics of all multigrid levels instead of CGeometry::UpdateGeometry, for preCICE implicit coupling.
+   * The coordinates of the fine level must be restored and communicated before.
+   * \param[in] checkpoint - Saved state.
+   */
+  void LoadGeometryMetrics(const CPreciceCheckpoint& checkpoint);
+
+  /*!
+   * \brief Get a field of the saved state by name, for preCICE implicit coupling.
+   * \param[in] field - Name of the field, e.g. SOLUTION_TIME_N1 or VOLUME_N.
+   * \return Pointer to the field member of CPreciceCheckpoint.
+   */
+  static CPreciceCheckpointBuffer CPreciceCheckpoint::* GetCheckpointField(const string& field);
+
+  /*!
+   * \brief Kernel of GetMarkerInitialCoordinates for a fixed number of dimensions, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] Coords - Contiguous buffer of vertices.size()*NDIM values.
+   */
+  template<unsigned short NDIM>
+  void GetMarkerInitialCoordinates_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Coords) const;
+
+  /*!
+   * \brief Kernel of SetMarkerMeshDisplacements for a fixed number of dimensions, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[in] Displacements - Contiguous buffer of vertices.size()*NDIM values.
+   */
+  template<unsigned short NDIM>
+  void SetMarkerMeshDisplacements_impl(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Displacements);
+
+  /*!
+   * \brief Kernel of GetMarkerFlowLoads for a fixed number of dimensions, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] FlowLoads - Contiguous buffer of vertices.size()*NDIM values.
+   */
+  template<unsigned short NDIM>
+  void GetMarkerFlowLoads_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* FlowLoads) const;
+
+  /*!
+   * \brief Kernel of GetMarkerVertexNormalHeatFluxes for a fixed number of dimensions, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] HeatFluxes - Contiguous buffer of vertices.size() values.
+   */
+  template<unsigned short NDIM>
+  void GetMarkerVertexNormalHeatFluxes_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* HeatFluxes) const;
+
+  /*!
+   * \brief Build the cached lists of physical (non-halo) vertices and points of the markers, for preCICE.
+   * The lists are rebuilt only if the partition (geometry or number of vertices) changed since the last call.
+   */
+  void SetMarkerPhysicalVertices() const;
+
+  /*!
+   * \brief Get the points of the physical (non-halo) vertices of a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Point identifiers, in the same order as GetMarkerPhysicalVertices.
+   */
+  const vector<unsigned long>& GetMarkerPhysicalPoints(unsigned short iMarker) const;
+
 public:
 
   /*!
@@ -498,6 +814,13 @@ public:
    */
   bool IsAHaloNode(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the indices of the physical (non-halo) vertices of a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Vertex identifiers.
+   */
+  const vector<unsigned long>& GetMarkerPhysicalVertices(unsigned short iMarker) const;
+
   /*!
    * \brief Get the number of external iterations.
    * \return Number of external iterations.
@@ -525,13 +848,173 @@ public:
   /*!
    * \brief Reload saved old state, for preCICE implicit coupling
    * Precondition: SaveOldState called first
+   * \param[in] nWindowsBack - Number of time windows to roll back beyond the last saved state, the newer states are discarded.
    */
-  void ReloadOldState();
+  void ReloadOldState(unsigned short nWindowsBack = 0);
 
   /*!
    * \brief Save old state, for preCICE implicit coupling
+   * The oldest state is overwritten once the ring of checkpoints is full.
+   * \param[in] TimeIter - Time iteration that runs next from the saved state, i.e. the first one of the time window.
   */
-  void SaveOldState();
+  void SaveOldState(unsigned long TimeIter);
+
+  /*!
+   * \brief Start saving the old state on a helper thread, for preCICE implicit coupling.
+   * Only the volume solution and geometry are read by the save, so the boundary data can be set meanwhile.
+   * WaitSaveOldState must be called before the solution is modified (i.e. before Preprocess); the other
+   * checkpoint functions wait for the save as well. The helper thread opens OpenMP teams of the size of the calling
+   * thread. AD builds save synchronously.
+   * \param[in] TimeIter - Time iteration that runs next from the saved state, i.e. the first one of the time window.
+   */
+  void StartSaveOldState(unsigned long TimeIter);
+
+  /*!
+   * \brief Wait for the save started by StartSaveOldState, for preCICE implicit coupling. Does nothing otherwise.
+   * Errors of the helper thread are raised here, on the calling thread.
+   */
+  void WaitSaveOldState() const;
+
+  /*!
+   * \brief Write every saved state to a raw binary file per rank, in the background, for preCICE implicit coupling.
+   * The file of each rank is filename_<rank>.bin, it always holds the last completely written state. Not available in AD builds.
+   * \param[in] filename - Base name of the files, empty to stop writing them.
+   */
+  void SetCheckpointFile(string filename);
+
+  /*!
+   * \brief Restore the state from the checkpoint files, e.g. to restart after a failure, for preCICE implicit coupling.
+   * The run must use the same mesh partition and checkpoint settings as the run that wrote the files. The state
+   * is also the first saved state, GetCheckpointTimeIter gives the time iteration to continue from.
+   * Precondition: SetCheckpointFile called first, and called before the first SaveOldState
+   */
+  void RestoreCheckpointFile();
+
+  /*!
+   * \brief Set the number of saved states that are kept, for preCICE implicit coupling.
+   * Precondition: called before the first SaveOldState
+   * \param[in] nCheckpoint - Number of states in the ring of checkpoints.
+   */
+  void SetnCheckpoint(unsigned short nCheckpoint);
+
+  /*!
+   * \brief Get the number of saved states that can be reloaded, for preCICE implicit coupling.
+   * \return Number of saved states.
+   */
+  unsigned short GetnCheckpoint() const;
+
+  /*!
+   * \brief Get the time window of a saved state, for preCICE implicit coupling.
+   * \param[in] nWindowsBack - Number of time windows before the last saved state.
+   * \return Time window (number of previous saves) of the state.
+   */
+  unsigned long GetCheckpointTimeWindow(unsigned short nWindowsBack = 0) const;
+
+  /*!
+   * \brief Get the time iteration of a saved state, for preCICE implicit coupling.
+   * \param[in] nWindowsBack - Number of time windows before the last saved state.
+   * \return Time iteration that runs next from the state, as passed to SaveOldState: after ReloadOldState(nWindowsBack),
+   * the time loop continues with this iteration.
+   */
+  unsigned long GetCheckpointTimeIter(unsigned short nWindowsBack = 0) const;
+
+  /*!
+   * \brief Store a field of the saved state in single precision, for preCICE implicit coupling.
+   * Precondition: called before the first SaveOldState
+   * \param[in] field - Name of the field (SOLUTION, SOLUTION_TIME_N, SOLUTION_TIME_N1, TURB_SOLUTION, TURB_SOLUTION_TIME_N,
+   *            TURB_SOLUTION_TIME_N1, MESH_SOLUTION, MESH_SOLUTION_TIME_N, MESH_SOLUTION_TIME_N1, COORD, GRID_VEL, VOLUME,
+   *            VOLUME_N, VOLUME_NM1).
+   * \param[in] single - Whether to store the field in single precision.
+   */
+  void SetCheckpointSinglePrecision(string field, bool single);
+
+  /*!
+   * \brief Get the largest round-trip error of a field stored in single precision, over all ranks, for preCICE implicit coupling.
+   * \param[in] field - Name of the field, see SetCheckpointSinglePrecision.
+   * \return Largest absolute difference between saved and restored values at the last save.
+   */
+  passivedouble GetCheckpointRoundTripError(string field) const;
+
+  /*!
+   * \brief Store a field of the saved state losslessly compressed, for preCICE implicit coupling.
+   * Meant for the cold levels (e.g. SOLUTION_TIME_N1), which are only read on reload. Only the solution fields can be compressed.
+   * Precondition: called before the first SaveOldState
+   * \param[in] field - Name of the field, see SetCheckpointSinglePrecision.
+   * \param[in] compress - Whether to compress the field.
+   */
+  void SetCheckpointCompression(string field, bool compress);
+
+  /*!
+   * \brief Get the compression ratio of a compressed field at the last save, over all ranks, for preCICE implicit coupling.
+   * \param[in] field - Name of the field, see SetCheckpointSinglePrecision.
+   * \return Uncompressed size divided by compressed size.
+   */
+  passivedouble GetCheckpointCompressionRatio(string field) const;
+
+  /*!
+   * \brief Save the solution levels of the halo points as well, for preCICE implicit coupling. They are consistent
+   * when saving, so reloading them replaces the SOLUTION comms of the flow, turbulence and mesh solvers (and the
+   * SOLUTION_TIME_N and SOLUTION_TIME_N1 comms of the mesh solver).
+   * Precondition: called before the first SaveOldState
+   * \param[in] halo - Whether to save the halo points.
+   */
+  void SetCheckpointHalo(bool halo);
+
+  /*!
+   * \brief Save the coarse multigrid levels, for preCICE implicit coupling. Reloading them replaces the restriction of
+   * the solution, the comms and the preprocessing of the coarse levels in FinalizeFLOW_SOL and FinalizeTURB_SOL.
+   * Precondition: called before the first SaveOldState
+   * \param[in] multigrid - Whether to save the coarse levels.
+   */
+  void SetCheckpointMultigrid(bool multigrid);
+
+  /*!
+   * \brief Save only the independent state, for preCICE implicit coupling. The coordinates are derived from the
+   * reference mesh and the mesh displacement, the grid velocity from the displacement levels, and the volume is
+   * recomputed from the coordinates on reload. The volumes at time n and n-1 are still stored.
+   * Precondition: called before the first SaveOldState
+   * \param[in] minimal - Whether to derive the fields on reload.
+   * \param[in] verify - Whether to also store the derived fields and compare them on reload (see GetCheckpointVerificationError).
+   */
+  void SetCheckpointMinimal(bool minimal, bool verify = false);
+
+  /*!
+   * \brief Get the largest differences between the derived and the stored fields at the last reload, over all ranks, for preCICE implicit coupling.
+   * \return Largest differences of the coordinates and of the volume.
+   */
+  vector<passivedouble> GetCheckpointVerificationError() const;
+
+  /*!
+   * \brief Save the dual-grid metrics (normals, volumes, coarse coordinates) with the checkpoint, for preCICE implicit coupling.
+   * They were valid at save time, so reloading them replaces CGeometry::UpdateGeometry in FinalizeFLOW_SOL. The first
+   * reload still rebuilds them, to measure the time saved (see GetCheckpointGeometryTime).
+   * Precondition: called before the first SaveOldState
+   * \param[in] metrics - Whether to save the metrics.
+   */
+  void SetCheckpointGeometryMetrics(bool metrics);
+
+  /*!
+   * \brief Get the time spent updating the geometry on reloads on this rank, for preCICE implicit coupling.
+   * \return Time to restore the saved metrics at the last reload (zero if they were not restored yet) and time
+   * of the last full rebuild by CGeometry::UpdateGeometry, in seconds.
+   */
+  vector<passivedouble> GetCheckpointGeometryTime() const;
+
+  /*!
+   * \brief Rewind the FLOW Solution by swapping it with the checkpoint buffer, for preCICE implicit coupling.
+   * The checkpoint is then restored lazily by CopyOnWriteOldState, which must be called before the solution is
+   * modified (i.e. before Run) after every ReloadOldState. It is only skipped if SaveOldState comes first with a
+   * single checkpoint (SetnCheckpoint), since the save then overwrites it. The copy is deferred, not avoided: a
+   * reload followed by a time iteration copies as much data as without swapping.
+   * \param[in] swap - Whether to swap the buffers instead of copying them.
+   */
+  void SetCheckpointSwap(bool swap);
+
+  /*!
+   * \brief Copy the FLOW Solution back into the checkpoint buffer if it was swapped out by ReloadOldState,
+   * for preCICE implicit coupling. Does nothing otherwise.
+   */
+  void CopyOnWriteOldState();
 
   /*!
    * \brief Get the name of the output file for the surface.
@@ -554,7 +1037,29 @@ public:
    * \return x,y,z coordinates of the vertex.
    */
   vector<passivedouble> GetInitialMeshCoord(unsigned short iMarker, unsigned long iVertex) const;
-  
+
+  /*!
+   * \brief Get undeformed coordinates of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] Coords - Contiguous buffer of vertices.size()*nDim values, one row of nDim components per vertex.
+   */
+  void GetMarkerInitialCoordinates(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Coords) const;
+
+  /*!
+   * \brief Get undeformed coordinates of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Coordinates, flattened row-wise with nDim components per vertex.
+   */
+  vector<passivedouble> GetMarkerInitialCoordinates(unsigned short iMarker) const;
+
+  /*!
+   * \brief Get the global indices of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Global indices, in the same order as GetMarkerInitialCoordinates.
+   */
+  vector<unsigned long> GetMarkerVertexGlobalIndices(unsigned short iMarker) const;
+
   /*!
    * \brief Get the temperature at a vertex on a specified marker.
    * \param[in] iMarker - Marker identifier.
@@ -603,6 +1108,113 @@ public:
    */
   passivedouble GetThermalConductivity(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the temperatures of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] Temperatures - Buffer of vertices.size() dimensional temperatures.
+   */
+  void GetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Temperatures) const;
+
+  /*!
+   * \brief Get the temperatures of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \return Dimensional temperatures of the vertices.
+   */
+  vector<passivedouble> GetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices) const;
+
+  /*!
+   * \brief Get the temperatures of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Dimensional temperatures of the vertices.
+   */
+  vector<passivedouble> GetMarkerVertexTemperatures(unsigned short iMarker) const;
+
+  /*!
+   * \brief Set the temperatures of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[in] Temperatures - Buffer of vertices.size() dimensional temperatures.
+   */
+  void SetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Temperatures);
+
+  /*!
+   * \brief Set the temperatures of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] Temperatures - Dimensional temperatures of the vertices.
+   * \param[in] vertices - Vertex identifiers.
+   */
+  void SetMarkerVertexTemperatures(unsigned short iMarker, const vector<passivedouble>& Temperatures, const vector<unsigned long>& vertices);
+
+  /*!
+   * \brief Set the temperatures of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] Temperatures - Dimensional temperatures of the vertices.
+   */
+  void SetMarkerVertexTemperatures(unsigned short iMarker, const vector<passivedouble>& Temperatures);
+
+  /*!
+   * \brief Get the wall normal heat fluxes of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] HeatFluxes - Buffer of vertices.size() dimensional normal heat fluxes.
+   */
+  void GetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* HeatFluxes) const;
+
+  /*!
+   * \brief Get the wall normal heat fluxes of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \return Dimensional normal heat fluxes of the vertices.
+   */
+  vector<passivedouble> GetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices) const;
+
+  /*!
+   * \brief Get the wall normal heat fluxes of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Dimensional normal heat fluxes of the vertices.
+   */
+  vector<passivedouble> GetMarkerVertexNormalHeatFluxes(unsigned short iMarker) const;
+
+  /*!
+   * \brief Set the wall normal heat fluxes of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[in] HeatFluxes - Buffer of vertices.size() dimensional normal heat fluxes.
+   */
+  void SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* HeatFluxes);
+
+  /*!
+   * \brief Set the wall normal heat fluxes of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] HeatFluxes - Dimensional normal heat fluxes of the vertices.
+   * \param[in] vertices - Vertex identifiers.
+   */
+  void SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<passivedouble>& HeatFluxes, const vector<unsigned long>& vertices);
+
+  /*!
+   * \brief Set the wall normal heat fluxes of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] HeatFluxes - Dimensional normal heat fluxes of the vertices.
+   */
+  void SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<passivedouble>& HeatFluxes);
+
+  /*!
+   * \brief Get the thermal conductivities of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] Conductivities - Buffer of vertices.size() thermal conductivities.
+   */
+  void GetMarkerThermalConductivities(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Conductivities) const;
+
+  /*!
+   * \brief Get the thermal conductivities of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Thermal conductivities of the vertices.
+   */
+  vector<passivedouble> GetMarkerThermalConductivities(unsigned short iMarker) const;
+
   /*!
    * \brief Preprocess the inlets via file input for all solvers.
    * \param[in] solver_container - Container vector with all the solutions.
@@ -676,6 +1288,29 @@ public:
    */
   void SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex, passivedouble DispX, passivedouble DispY, passivedouble DispZ);
 
+  /*!
+   * \brief Set the mesh displacements of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[in] Displacements - Contiguous buffer of vertices.size()*nDim values, one row of nDim components per vertex.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Displacements);
+
+  /*!
+   * \brief Set the mesh displacements of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] Displacements - Displacements, flattened row-wise with nDim components per vertex.
+   * \param[in] vertices - Vertex identifiers.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& Displacements, const vector<unsigned long>& vertices);
+
+  /*!
+   * \brief Set the mesh displacements of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] Displacements - Displacements, flattened row-wise with nDim components per vertex.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& Displacements);
+
   /*!
    * \brief Communicate the boundary mesh displacements in a python call
    */
@@ -742,6 +1377,102 @@ public:
    */
   vector<passivedouble> GetFlowLoad(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the flow loads of several vertices on a marker in one call, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \param[out] FlowLoads - Contiguous buffer of vertices.size()*nDim values, one row of nDim components per vertex.
+   */
+  void GetMarkerFlowLoads(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* FlowLoads) const;
+
+  /*!
+   * \brief Get the flow loads of several vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] vertices - Vertex identifiers.
+   * \return Flow loads, flattened row-wise with nDim components per vertex.
+   */
+  vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker, const vector<unsigned long>& vertices) const;
+
+  /*!
+   * \brief Get the flow loads of all physical (non-halo) vertices on a marker, for preCICE.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flow loads, flattened row-wise with nDim components per vertex.
+   */
+  vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker) const;
+
+  /*!
+   * \brief Add a marker to the coupling interface of RunCouplingStep, for preCICE. The buffers of RunCouplingStep
+   * hold the values of the physical (non-halo) vertices of the markers, marker after marker in the order they were added.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] readData - Data set on the marker, "DISPLACEMENT", "TEMPERATURE", "HEAT_FLUX" or "" for none.
+   * \param[in] writeData - Data got from the marker, "FORCE", "TEMPERATURE", "HEAT_FLUX" or "" for none.
+   */
+  void AddCouplingStepMarker(unsigned short iMarker, string readData, string writeData);
+
+  /*!
+   * \brief Remove all markers from the coupling interface of RunCouplingStep, for preCICE.
+   */
+  void ClearCouplingStepMarkers();
+
+  /*!
+   * \brief Get the number of values of the read data buffer of RunCouplingStep, for preCICE.
+   * \return Number of values, nDim per vertex for displacements and one per vertex otherwise.
+   */
+  unsigned long GetCouplingStepReadSize() const;
+
+  /*!
+   * \brief Get the number of values of the write data buffer of RunCouplingStep, for preCICE.
+   * \return Number of values, nDim per vertex for forces and one per vertex otherwise.
+   */
+  unsigned long GetCouplingStepWriteSize() const;
+
+  /*!
+   * \brief Run one coupled time iteration in a single call, for preCICE. Sets the read data on the coupling markers
+   * (and updates the boundary conditions for temperatures and heat fluxes), sets the time step, waits for the state saved
+   * by StartSaveOldState and restores a swapped checkpoint, runs the time iteration up to Monitor, and gets the write data.
+   * \param[in] TimeIter - Time iteration.
+   * \param[in] deltaT - Time step of the iteration.
+   * \param[in] ReadData - Contiguous buffer of GetCouplingStepReadSize values.
+   * \param[out] WriteData - Contiguous buffer of GetCouplingStepWriteSize values.
+   * \return Whether the computation must stop, as returned by Monitor.
+   */
+  bool RunCouplingStep(unsigned long TimeIter, passivedouble deltaT, const passivedouble* ReadData, passivedouble* WriteData);
+
+  /*!
+   * \brief Run one coupled time iteration in a single call, for preCICE. The write data is then given by GetCouplingStepWriteData.
+   * \param[in] TimeIter - Time iteration.
+   * \param[in] deltaT - Time step of the iteration.
+   * \param[in] ReadData - Read data, GetCouplingStepReadSize values.
+   * \return Whether the computation must stop, as returned by Monitor.
+   */
+  bool RunCouplingStep(unsigned long TimeIter, passivedouble deltaT, const vector<passivedouble>& ReadData);
+
+  /*!
+   * \brief Get the write data of the last RunCouplingStep called with a vector, for preCICE.
+   * \return Write data, GetCouplingStepWriteSize values.
+   */
+  const vector<passivedouble>& GetCouplingStepWriteData() const;
+
+  /*!
+   * \brief Get the solution of a solver on the finest mesh without copying it, for preCICE. Not available in AD builds.
+   * \param[in] solver - Name of the solver, "FLOW", "TURB", "TRANS", "SPECIES", "HEAT" or "MESH".
+   * \param[out] nPoint - Number of points, including the halo points.
+   * \param[out] nVar - Number of variables per point.
+   * \return Solution, nPoint*nVar values row-wise, valid while the driver exists. With SetCheckpointSwap, every
+   * ReloadOldState swaps the FLOW solution with the checkpoint buffer, which the pointer then still refers to: it
+   * must be fetched again after each reload.
+   */
+  const passivedouble* GetSolverSolutionData(string solver, unsigned long& nPoint, unsigned short& nVar) const;
+
+  /*!
+   * \brief Get the primitive variables of the flow solver on the finest mesh without copying them, for preCICE.
+   * Not available in AD builds.
+   * \param[out] nPoint - Number of points, including the halo points.
+   * \param[out] nPrimVar - Number of primitive variables per point.
+   * \return Primitive variables, nPoint*nPrimVar values row-wise, valid while the driver exists.
+   */
+  const passivedouble* GetPrimitiveData(unsigned long& nPoint, unsigned short& nPrimVar) const;
+
   /*!
    * \brief Set the adjoint of the flow tractions (from the extra step -
    * the repeated methods should be unified once the postprocessing strategy is in place).
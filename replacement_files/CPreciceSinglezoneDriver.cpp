@@ -0,0 +1,321 @@
+/*!
+ *
+ * Added for coupling with preCICE
+ * \file CPreciceSinglezoneDriver.cpp
+ * \brief The main subroutines of the driver running the preCICE coupling loop of single-zone problems.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPreciceSinglezoneDriver.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+/*--- Remove the leading and trailing white space of a string. ---*/
+string Trim(const string& str) {
+  const auto begin = str.find_first_not_of(" \t\r\n");
+  if (begin == string::npos) return "";
+  const auto end = str.find_last_not_of(" \t\r\n");
+  return str.substr(begin, end - begin + 1);
+}
+
+string ToUpper(string str) {
+  transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return toupper(c); });
+  return str;
+}
+
+/*--- Split a list value, "( A, B )" or "A, B", into its entries. ---*/
+vector<string> SplitList(string value) {
+  replace(value.begin(), value.end(), '(', ' ');
+  replace(value.begin(), value.end(), ')', ' ');
+  vector<string> list;
+  stringstream stream(value);
+  string entry;
+  while (getline(stream, entry, ',')) {
+    entry = Trim(entry);
+    if (!entry.empty()) list.push_back(entry);
+  }
+  return list;
+}
+
+bool ParseBool(const string& key, const string& value) {
+  const auto upper = ToUpper(value);
+  if (upper == "YES") return true;
+  if (upper == "NO") return false;
+  SU2_MPI::Error("Option " + key + " must be YES or NO, not " + value + ".", CURRENT_FUNCTION);
+  return false;
+}
+
+}  // namespace
+
+CPreciceSinglezoneDriver::CPreciceSinglezoneDriver(char* confFile, const string& preciceConfFile,
+                                                   SU2_Comm MPICommunicator)
+    : CSinglezoneDriver(confFile, 1, MPICommunicator), Communicator(MPICommunicator) {
+
+  ReadOptions(preciceConfFile);
+  SetCheckpointOptions();
+}
+
+CPreciceSinglezoneDriver::~CPreciceSinglezoneDriver(void) = default;
+
+void CPreciceSinglezoneDriver::ReadOptions(const string& filename) {
+
+  ifstream file(filename);
+  if (!file.is_open()) {
+    SU2_MPI::Error("Cannot open the preCICE adapter options file " + filename + ".", CURRENT_FUNCTION);
+  }
+
+  string line;
+  while (getline(file, line)) {
+
+    /*--- Everything after % is a comment, as in the SU2 config files. ---*/
+    line = Trim(line.substr(0, line.find('%')));
+    if (line.empty()) continue;
+
+    const auto equal = line.find('=');
+    if (equal == string::npos) {
+      SU2_MPI::Error("Line \"" + line + "\" of " + filename + " is not of the form KEY= value.", CURRENT_FUNCTION);
+    }
+    const auto key = ToUpper(Trim(line.substr(0, equal)));
+    const auto value = Trim(line.substr(equal + 1));
+
+    if (key == "PRECICE_PARTICIPANT") Options.Participant = value;
+    else if (key == "PRECICE_CONFIG") Options.Config = value;
+    else if (key == "PRECICE_MESH") Options.Mesh = value;
+    else if (key == "PRECICE_MARKER") Options.Marker = value;
+    else if (key == "PRECICE_COUPLING") Options.Coupling = ToUpper(value);
+    else if (key == "PRECICE_REVERSE") Options.Reverse = ParseBool(key, value);
+    else if (key == "PRECICE_READ_DATA") Options.ReadData = value;
+    else if (key == "PRECICE_WRITE_DATA") Options.WriteData = value;
+    else if (key == "CHECKPOINT_NUMBER") Options.nCheckpoint = static_cast<unsigned short>(stoul(value));
+    else if (key == "CHECKPOINT_SWAP") Options.CheckpointSwap = ParseBool(key, value);
+    else if (key == "CHECKPOINT_SINGLE") Options.CheckpointSingle = SplitList(value);
+    else if (key == "CHECKPOINT_COMPRESS") Options.CheckpointCompress = SplitList(value);
+    else if (key == "CHECKPOINT_MULTIGRID") Options.CheckpointMultigrid = ParseBool(key, value);
+    else if (key == "CHECKPOINT_HALO") Options.CheckpointHalo = ParseBool(key, value);
+    else if (key == "CHECKPOINT_MINIMAL") Options.CheckpointMinimal = ParseBool(key, value);
+    else if (key == "CHECKPOINT_VERIFY") Options.CheckpointVerify = ParseBool(key, value);
+    else if (key == "CHECKPOINT_METRICS") Options.CheckpointMetrics = ParseBool(key, value);
+    else if (key == "CHECKPOINT_ASYNC") Options.CheckpointAsync = ParseBool(key, value);
+    else if (key == "CHECKPOINT_FILE") Options.CheckpointFile = value;
+    else if (key == "CHECKPOINT_RESTORE") Options.CheckpointRestore = ParseBool(key, value);
+    else SU2_MPI::Error("Unknown option " + key + " in " + filename + ".", CURRENT_FUNCTION);
+  }
+
+  if (Options.Coupling != "FSI" && Options.Coupling != "CHT") {
+    SU2_MPI::Error("PRECICE_COUPLING must be FSI or CHT, not " + Options.Coupling + ".", CURRENT_FUNCTION);
+  }
+  CHT = (Options.Coupling == "CHT");
+  nValue = CHT ? 1 : nDim;
+
+  /*--- Same default data names as the SU2_preCICE_FSI.py and SU2_preCICE_CHT.py scripts. ---*/
+  string read = "Displacement", write = "Force";
+  if (CHT) {
+    read = Options.Reverse ? "Heat-Flux" : "Temperature";
+    write = Options.Reverse ? "Temperature" : "Heat-Flux";
+  }
+  if (Options.ReadData.empty()) Options.ReadData = read;
+  if (Options.WriteData.empty()) Options.WriteData = write;
+
+  if (Options.CheckpointRestore && Options.CheckpointFile.empty()) {
+    SU2_MPI::Error("CHECKPOINT_RESTORE requires CHECKPOINT_FILE.", CURRENT_FUNCTION);
+  }
+
+  /*--- The geometry options only apply to a deforming mesh, i.e. to FSI. ---*/
+  if (CHT && (Options.CheckpointMinimal || Options.CheckpointMetrics)) {
+    SU2_MPI::Error("CHECKPOINT_MINIMAL and CHECKPOINT_METRICS only apply to PRECICE_COUPLING= FSI.", CURRENT_FUNCTION);
+  }
+  if (Options.CheckpointVerify && !Options.CheckpointMinimal) {
+    SU2_MPI::Error("CHECKPOINT_VERIFY requires CHECKPOINT_MINIMAL.", CURRENT_FUNCTION);
+  }
+}
+
+void CPreciceSinglezoneDriver::SetCheckpointOptions() {
+
+  SetCheckpointSwap(Options.CheckpointSwap);
+  SetnCheckpoint(Options.nCheckpoint);
+  for (const auto& field : Options.CheckpointSingle) SetCheckpointSinglePrecision(field, true);
+  for (const auto& field : Options.CheckpointCompress) SetCheckpointCompression(field, true);
+  SetCheckpointMultigrid(Options.CheckpointMultigrid);
+  SetCheckpointHalo(Options.CheckpointHalo);
+  SetCheckpointMinimal(Options.CheckpointMinimal, Options.CheckpointVerify);
+  SetCheckpointGeometryMetrics(Options.CheckpointMetrics);
+  if (!Options.CheckpointFile.empty()) SetCheckpointFile(Options.CheckpointFile);
+  if (Options.CheckpointRestore) RestoreCheckpointFile();
+}
+
+void CPreciceSinglezoneDriver::SetCouplingInterface() {
+
+#ifdef HAVE_MPI
+  Participant.reset(new precice::Participant(Options.Participant, Options.Config, rank, size, &Communicator));
+#else
+  Participant.reset(new precice::Participant(Options.Participant, Options.Config, rank, size));
+#endif
+
+  if (Participant->getMeshDimensions(Options.Mesh) != nDim) {
+    SU2_MPI::Error("SU2 and preCICE dimensions of mesh " + Options.Mesh + " are not the same.", CURRENT_FUNCTION);
+  }
+
+  /*--- The coupling marker must have the deform mesh (FSI) or CHT option, it may not be on every rank. ---*/
+  const auto markers = CHT ? GetAllCHTMarkersTag() : GetAllDeformMeshMarkersTag();
+  if (find(markers.begin(), markers.end(), Options.Marker) == markers.end()) {
+    SU2_MPI::Error("Marker " + Options.Marker + (CHT ? " is not a CHT marker (MARKER_PYTHON_CUSTOM)."
+                                                     : " is not in MARKER_DEFORM_MESH."), CURRENT_FUNCTION);
+  }
+  const auto allMarkers = GetAllBoundaryMarkers();
+  const auto it = allMarkers.find(Options.Marker);
+  CouplingMarker = (it == allMarkers.end()) ? -1 : it->second;
+
+  vector<passivedouble> coords;
+  if (CouplingMarker >= 0) {
+    const auto& vertices = GetMarkerPhysicalVertices(CouplingMarker);
+    coords.resize(vertices.size() * nDim);
+    GetMarkerInitialCoordinates(CouplingMarker, vertices, coords.data());
+  }
+  const auto nVertex = coords.size() / nDim;
+
+  VertexIDs.resize(nVertex);
+  Participant->setMeshVertices(Options.Mesh, coords, VertexIDs);
+
+  ReadValues.assign(nVertex * nValue, 0.0);
+  WriteValues.assign(nVertex * nValue, 0.0);
+
+  /*--- Data set and got on the marker by RunCouplingStep. ---*/
+  if (CouplingMarker >= 0) {
+    if (!CHT) AddCouplingStepMarker(CouplingMarker, "DISPLACEMENT", "FORCE");
+    else if (Options.Reverse) AddCouplingStepMarker(CouplingMarker, "HEAT_FLUX", "TEMPERATURE");
+    else AddCouplingStepMarker(CouplingMarker, "TEMPERATURE", "HEAT_FLUX");
+  }
+}
+
+void CPreciceSinglezoneDriver::GetInitialValues() {
+
+  if (CouplingMarker < 0) return;
+  const auto& vertices = GetMarkerPhysicalVertices(CouplingMarker);
+
+  if (!CHT) {
+    GetMarkerFlowLoads(CouplingMarker, vertices, WriteValues.data());
+    return;
+  }
+
+  /*--- As in SU2_preCICE_CHT.py, the initial data is the quantity set on the marker by the config file. ---*/
+  if (Options.Reverse) GetMarkerVertexNormalHeatFluxes(CouplingMarker, vertices, WriteValues.data());
+  else GetMarkerVertexTemperatures(CouplingMarker, vertices, WriteValues.data());
+}
+
+void CPreciceSinglezoneDriver::StartSolver() {
+
+  StartTime = SU2_MPI::Wtime();
+  config_container[ZONE_0]->Set_StartTime(StartTime);
+
+  SetCouplingInterface();
+
+  passivedouble deltaT = GetUnsteady_TimeStep();
+  TimeIter = GetTime_Iter();
+  if (Options.CheckpointRestore) {
+    /*--- Continue from the time iteration of the restored state. ---*/
+    TimeIter = GetCheckpointTimeIter();
+  }
+
+  /*--- Set up initial data for preCICE. ---*/
+  if (Participant->requiresInitialData()) {
+    GetInitialValues();
+    Participant->writeData(Options.Mesh, Options.WriteData, VertexIDs, WriteValues);
+  }
+
+  Participant->initialize();
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+
+  unsigned long savedTimeIter = TimeIter;
+  bool checkpointWritten = false;
+
+  while (Participant->isCouplingOngoing()) {
+
+    /*--- Implicit coupling, save the state, on a helper thread while the coupling data is read if requested. ---*/
+    if (Participant->requiresWritingCheckpoint()) {
+      if (Options.CheckpointAsync) StartSaveOldState(TimeIter);
+      else SaveOldState(TimeIter);
+      checkpointWritten = true;
+      savedTimeIter = TimeIter;
+    }
+
+    /*--- Time step of this iteration, limited by preCICE. ---*/
+    deltaT = min(Participant->getMaxTimeStepSize(), GetUnsteady_TimeStep());
+
+    /*--- Retrieve the data from preCICE, set it on the coupling marker, run one time iteration and get the write data.
+     * This waits for the state saved on a helper thread and restores a checkpoint swapped out by the last reload. ---*/
+    Participant->readData(Options.Mesh, Options.ReadData, VertexIDs, deltaT, ReadValues);
+    StopCalc = RunCouplingStep(TimeIter, deltaT, ReadValues.data(), WriteValues.data());
+    TimeIter++;
+
+    /*--- The checkpoint statistics are reduced over all ranks, every rank gets them and the master prints them. ---*/
+    if (checkpointWritten) {
+      stringstream info;
+      for (const auto& field : Options.CheckpointSingle)
+        info << "Checkpoint field " << field << " stored in single precision, maximum round-trip error: "
+             << scientific << GetCheckpointRoundTripError(field) << "\n";
+      for (const auto& field : Options.CheckpointCompress)
+        info << "Checkpoint field " << field << " stored compressed, compression ratio: "
+             << fixed << setprecision(2) << GetCheckpointCompressionRatio(field) << "\n";
+      if (rank == MASTER_NODE) cout << info.str() << flush;
+    }
+    checkpointWritten = false;
+
+    /*--- Write the data to preCICE and advance the coupling. ---*/
+    Participant->writeData(Options.Mesh, Options.WriteData, VertexIDs, WriteValues);
+    Participant->advance(deltaT);
+
+    /*--- Implicit coupling, reload the state saved at the beginning of the time window. ---*/
+    if (Participant->requiresReadingCheckpoint()) {
+      ReloadOldState();
+      stringstream info;
+      if (!CHT && Options.CheckpointMinimal && Options.CheckpointVerify) {
+        const auto error = GetCheckpointVerificationError();
+        info << "Derived checkpoint fields, maximum difference of coordinates: " << scientific << error[0]
+             << ", volumes: " << error[1] << "\n";
+      }
+      if (!CHT && Options.CheckpointMetrics) {
+        const auto geometryTime = GetCheckpointGeometryTime();
+        if (geometryTime[0] > 0.0)
+          info << "Saved geometry metrics restored in " << scientific << setprecision(3) << geometryTime[0]
+               << " s instead of " << geometryTime[1] << " s for the rebuild\n";
+      }
+      if (rank == MASTER_NODE) cout << info.str() << flush;
+      TimeIter = savedTimeIter;
+    }
+
+    if (Participant->isTimeWindowComplete()) {
+      Output(TimeIter);
+      if (StopCalc) break;
+    }
+  }
+
+  Participant->finalize();
+}
@@ -0,0 +1,127 @@
+/*!
+ *
+ * Added for coupling with preCICE
+ * \file CPreciceSinglezoneDriver.hpp
+ * \brief Headers of the driver running the preCICE coupling loop of single-zone problems.
+ *        The subroutines and functions are in the <i>CPreciceSinglezoneDriver.cpp</i> file.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSinglezoneDriver.hpp"
+
+#include <memory>
+#include <precice/precice.hpp>
+
+/*!
+ * \class CPreciceSinglezoneDriver
+ * \brief Single-zone driver coupled through the preCICE C++ API, it runs the same loop as the
+ *        SU2_preCICE_FSI.py and SU2_preCICE_CHT.py scripts.
+ */
+class CPreciceSinglezoneDriver : public CSinglezoneDriver {
+
+protected:
+
+  /*!
+   * \brief Settings of the coupling, read from the adapter options file.
+   */
+  struct CPreciceOptions {
+    string Participant = "Fluid";               /*!< \brief preCICE participant name. */
+    string Config = "../precice-config.xml";    /*!< \brief preCICE configuration file. */
+    string Mesh = "Fluid-Mesh";                 /*!< \brief preCICE mesh name. */
+    string Marker = "interface";                /*!< \brief SU2 marker of the coupling interface. */
+    string Coupling = "FSI";                    /*!< \brief Kind of coupling, FSI or CHT. */
+    bool Reverse = false;                       /*!< \brief CHT only, read the heat flux and write the temperature. */
+    string ReadData;                            /*!< \brief preCICE read data name, default by kind of coupling. */
+    string WriteData;                           /*!< \brief preCICE write data name, default by kind of coupling. */
+
+    unsigned short nCheckpoint = 1;             /*!< \brief Number of saved states kept for rolling back. */
+    bool CheckpointSwap = false;                /*!< \brief Rewind the flow solution by swapping buffers. */
+    vector<string> CheckpointSingle;            /*!< \brief Checkpoint fields stored in single precision. */
+    vector<string> CheckpointCompress;          /*!< \brief Checkpoint fields stored losslessly compressed. */
+    bool CheckpointHalo = false;                /*!< \brief Save the halo points as well. */
+    bool CheckpointMultigrid = false;           /*!< \brief Save the coarse multigrid levels. */
+    bool CheckpointMinimal = false;             /*!< \brief Derive the mesh coordinates, grid velocity and volume on reload. */
+    bool CheckpointVerify = false;              /*!< \brief Compare the derived fields with saved ones on reload. */
+    bool CheckpointMetrics = false;             /*!< \brief Save the dual-grid metrics. */
+    bool CheckpointAsync = false;               /*!< \brief Save the state on a helper thread while the coupling data is read. */
+    string CheckpointFile;                      /*!< \brief Base name of the checkpoint files, empty if not written. */
+    bool CheckpointRestore = false;             /*!< \brief Restart from the checkpoint files. */
+  };
+
+  CPreciceOptions Options;                      /*!< \brief Settings of the coupling. */
+  SU2_Comm Communicator;                        /*!< \brief Communicator passed to preCICE. */
+  unique_ptr<precice::Participant> Participant; /*!< \brief preCICE participant of this driver. */
+
+  bool CHT = false;                             /*!< \brief Conjugate heat transfer (true) or fluid-structure interaction (false). */
+  int CouplingMarker = -1;                      /*!< \brief Index of the coupling marker on this rank, -1 if it is not on this rank. */
+  unsigned short nValue = 1;                    /*!< \brief Number of values per vertex of the read and write data. */
+  vector<precice::VertexID> VertexIDs;          /*!< \brief preCICE identifiers of the physical vertices of the coupling marker. */
+  vector<passivedouble> ReadValues;             /*!< \brief Values read from preCICE, nValue per physical vertex. */
+  vector<passivedouble> WriteValues;            /*!< \brief Values written to preCICE, nValue per physical vertex. */
+
+  /*!
+   * \brief Read the adapter options file, in the syntax of the SU2 config files (KEY= value, % starts a comment).
+   * \param[in] filename - Name of the options file.
+   */
+  void ReadOptions(const string& filename);
+
+  /*!
+   * \brief Apply the checkpoint settings of the options to the driver.
+   */
+  void SetCheckpointOptions();
+
+  /*!
+   * \brief Create the preCICE participant, find the coupling marker, define its physical vertices as the preCICE mesh
+   *        and add it to the coupling step.
+   */
+  void SetCouplingInterface();
+
+  /*!
+   * \brief Get the initial data at the physical vertices of the coupling marker into WriteValues. As in the scripts,
+   *        this is the force (FSI) or the quantity of the CHT marker set by the config file, opposite to the write data.
+   */
+  void GetInitialValues();
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] preciceConfFile - Adapter options file name.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CPreciceSinglezoneDriver(char* confFile, const string& preciceConfFile, SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CPreciceSinglezoneDriver(void) override;
+
+  /*!
+   * \brief Run the coupled time loop until preCICE ends the coupling or the solver stops.
+   */
+  void StartSolver() override;
+
+};
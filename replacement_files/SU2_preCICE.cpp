@@ -0,0 +1,77 @@
+/*!
+ *
+ * Added for coupling with preCICE
+ * \file SU2_preCICE.cpp
+ * \brief Main file of SU2 coupled through preCICE, running the coupling loop in C++.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/SU2_CFD.hpp"
+#include "../include/drivers/CPreciceSinglezoneDriver.hpp"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+
+  char config_file_name[MAX_STRING_SIZE];
+
+  /*--- OpenMP initialization ---*/
+
+  omp_initialize();
+
+  /*--- MPI initialization, and buffer setting ---*/
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+  SU2_MPI::Comm MPICommunicator = SU2_MPI::GetComm();
+
+  /*--- Usage: SU2_preCICE su2.cfg [precice-adapter.cfg] ---*/
+
+  if (argc < 2 || argc > 3) {
+    SU2_MPI::Error("Usage: SU2_preCICE SU2_config_file.cfg [precice_adapter_file.cfg]", CURRENT_FUNCTION);
+  }
+  strcpy(config_file_name, argv[1]);
+  const string precice_file_name = (argc == 3) ? argv[2] : "precice-adapter.cfg";
+
+  /*--- Create the driver, this includes solver preprocessing, and run the coupled time loop. ---*/
+
+  CDriver* driver = new CPreciceSinglezoneDriver(config_file_name, precice_file_name, MPICommunicator);
+
+  driver->StartSolver();
+
+  /*--- Postprocess all the containers, close history file, exit SU2 ---*/
+
+  driver->Postprocessing();
+
+  delete driver;
+
+  /*--- Finalize MPI parallelization. ---*/
+
+  SU2_MPI::Finalize();
+
+  return EXIT_SUCCESS;
+}
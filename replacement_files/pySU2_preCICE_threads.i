@@ -0,0 +1,32 @@
+/*
+ * SWIG interface snippet of the SU2-preCICE adapter, included by pySU2.i right after its %module line.
+ * Part of the SU2-preCICE adapter: https://github.com/precice/su2-adapter
+ * This adapter is distributed under the GNU Lesser General Public
+ * License (see LICENSE file).
+ *
+ * The module is built with SWIG thread support (%module(threads="1")). The GIL is only released around the
+ * long-running driver calls below, which do not touch any Python object, so that Python helper threads
+ * (logging, monitoring, staging the preCICE data) can run meanwhile. All other calls keep the GIL.
+ * The driver itself is not thread-safe: no other driver method may be called while one of these runs.
+ */
+
+%nothread;
+
+/*--- Time iteration ---*/
+%thread Preprocess;
+%thread Run;
+%thread Postprocess;
+%thread Update;
+%thread Monitor;
+%thread Output;
+%thread RunCouplingStep;
+%thread StartSolver;
+%thread Postprocessing;
+%thread BoundaryConditionsUpdate;
+
+/*--- Checkpoints for implicit coupling ---*/
+%thread SaveOldState;
+%thread WaitSaveOldState;
+%thread ReloadOldState;
+%thread CopyOnWriteOldState;
+%thread RestoreCheckpointFile;
@@ -0,0 +1,150 @@
+/*
+ * SWIG interface snippet of the SU2-preCICE adapter, included by pySU2.i right after its %module line.
+ * Part of the SU2-preCICE adapter: https://github.com/precice/su2-adapter
+ * This adapter is distributed under the GNU Lesser General Public
+ * License (see LICENSE file).
+ *
+ * Read-only views of the solver data, without copy, for builds without AD (su2double is double), and of the
+ * write data of RunCouplingStep. The flow loads are computed on request and have no view, GetMarkerFlowLoads copies them.
+ * The views are Python memoryviews of shape (nPoint, nVar) over the memory of the driver,
+ * numpy.asarray turns them into read-only NumPy arrays without copy. Their buffer is exported by a small object that
+ * holds a reference to the Python driver, so a view (or an array made from it) keeps the driver alive. They must still
+ * not be used after its Postprocessing, which frees the solver data.
+ * With the swap rewind (SetCheckpointSwap), every ReloadOldState exchanges the memory of the FLOW solution with the
+ * checkpoint buffer, so a FLOW view taken before it shows the discarded iterate and must be taken again.
+ */
+
+%ignore CDriver::GetSolverSolutionData;
+%ignore CDriver::GetPrimitiveData;
+
+%{
+/*--- Exporter of the buffer of a view, it keeps the Python driver (owner) alive as long as the view exists. ---*/
+struct preCICE_ViewExporter {
+  PyObject_HEAD
+  PyObject* owner;
+  double* data;
+  int ndim;
+  Py_ssize_t shape[2];
+  Py_ssize_t strides[2];
+};
+
+static void preCICE_ViewExporter_Dealloc(PyObject* self) {
+  Py_XDECREF(reinterpret_cast<preCICE_ViewExporter*>(self)->owner);
+  PyObject_Del(self);
+}
+
+static int preCICE_ViewExporter_GetBuffer(PyObject* self, Py_buffer* view, int flags) {
+  const preCICE_ViewExporter* exporter = reinterpret_cast<preCICE_ViewExporter*>(self);
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+    view->obj = nullptr;
+    PyErr_SetString(PyExc_BufferError, "The views of the SU2 driver are read-only.");
+    return -1;
+  }
+  view->obj = self;
+  Py_INCREF(self);
+  view->buf = exporter->data;
+  view->len = exporter->shape[0]*exporter->shape[1]*static_cast<Py_ssize_t>(sizeof(double));
+  view->readonly = 1;
+  view->itemsize = sizeof(double);
+  view->format = ((flags & PyBUF_FORMAT) == PyBUF_FORMAT) ? const_cast<char*>("d") : nullptr;
+  view->ndim = exporter->ndim;
+  view->shape = ((flags & PyBUF_ND) == PyBUF_ND) ? const_cast<Py_ssize_t*>(exporter->shape) : nullptr;
+  view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? const_cast<Py_ssize_t*>(exporter->strides) : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+static PyTypeObject* preCICE_ViewExporter_Type() {
+  static PyBufferProcs buffer = {preCICE_ViewExporter_GetBuffer, nullptr};
+  static PyTypeObject type = {PyVarObject_HEAD_INIT(nullptr, 0)};
+  if (type.tp_name == nullptr) {
+    type.tp_name = "pysu2.preCICE_ViewExporter";
+    type.tp_basicsize = sizeof(preCICE_ViewExporter);
+    type.tp_flags = Py_TPFLAGS_DEFAULT;
+    type.tp_dealloc = preCICE_ViewExporter_Dealloc;
+    type.tp_as_buffer = &buffer;
+    type.tp_doc = "Read-only buffer of the SU2 driver, viewed without copy.";
+    if (PyType_Ready(&type) < 0) {
+      type.tp_name = nullptr;
+      return nullptr;
+    }
+  }
+  return &type;
+}
+
+/*--- Read-only memoryview of n rows of m doubles (or of n*m doubles if not a matrix), without copy. The owner is
+ *    set by preCICE_KeepAlive. ---*/
+static PyObject* preCICE_View(const double* data, unsigned long n, unsigned long m, bool matrix = true) {
+  static double empty = 0.0;
+  PyTypeObject* type = preCICE_ViewExporter_Type();
+  if (type == nullptr) return nullptr;
+  preCICE_ViewExporter* exporter = PyObject_New(preCICE_ViewExporter, type);
+  if (exporter == nullptr) return nullptr;
+
+  exporter->owner = nullptr;
+  exporter->data = (n*m == 0) ? &empty : const_cast<double*>(data);
+  exporter->ndim = (matrix) ? 2 : 1;
+  exporter->shape[0] = static_cast<Py_ssize_t>((matrix) ? n : n*m);
+  exporter->shape[1] = static_cast<Py_ssize_t>((matrix) ? m : 1);
+  exporter->strides[0] = static_cast<Py_ssize_t>(((matrix) ? m : 1)*sizeof(double));
+  exporter->strides[1] = sizeof(double);
+
+  PyObject* view = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(exporter));
+  Py_DECREF(exporter);
+  return view;
+}
+%}
+
+/*--- Called by the Python methods below on their result, ties the lifetime of the driver to the view. ---*/
+%inline %{
+static PyObject* preCICE_KeepAlive(PyObject* view, PyObject* owner) {
+  PyObject* exporter = PyMemoryView_Check(view) ? PyMemoryView_GET_BASE(view) : nullptr;
+  if ((exporter == nullptr) || (Py_TYPE(exporter) != preCICE_ViewExporter_Type())) {
+    PyErr_SetString(PyExc_TypeError, "Not a view of the SU2 driver.");
+    return nullptr;
+  }
+  PyObject*& held = reinterpret_cast<preCICE_ViewExporter*>(exporter)->owner;
+  Py_XINCREF(owner);
+  Py_XDECREF(held);
+  held = owner;
+  Py_INCREF(view);
+  return view;
+}
+%}
+
+%pythonappend CDriver::GetCouplingStepWriteView %{ val = preCICE_KeepAlive(val, self) %}
+%pythonappend CDriver::GetSolverSolutionView %{ val = preCICE_KeepAlive(val, self) %}
+%pythonappend CDriver::GetPrimitiveView %{ val = preCICE_KeepAlive(val, self) %}
+
+%extend CDriver {
+
+  /*--- Write data of the last RunCouplingStep, updated by every call in the same memory (also in AD builds).
+   *    Adding or clearing coupling markers resizes it, the view must then be taken again. ---*/
+  PyObject* GetCouplingStepWriteView() const {
+    const std::vector<passivedouble>& data = $self->GetCouplingStepWriteData();
+    return preCICE_View(data.data(), data.size(), 1, false);
+  }
+}
+
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+%extend CDriver {
+
+  /*--- Solution of a solver ("FLOW", "TURB", "TRANS", "SPECIES", "HEAT" or "MESH"), including the halo points.
+   *    With the swap rewind, the FLOW view must be taken again after every ReloadOldState. ---*/
+  PyObject* GetSolverSolutionView(const char* solver) const {
+    unsigned long nPoint = 0;
+    unsigned short nVar = 0;
+    const passivedouble* data = $self->GetSolverSolutionData(solver, nPoint, nVar);
+    return preCICE_View(data, nPoint, nVar);
+  }
+
+  /*--- Primitive variables of the flow solver, including the halo points. ---*/
+  PyObject* GetPrimitiveView() const {
+    unsigned long nPoint = 0;
+    unsigned short nPrimVar = 0;
+    const passivedouble* data = $self->GetPrimitiveData(nPoint, nPrimVar);
+    return preCICE_View(data, nPoint, nPrimVar);
+  }
+}
+#endif
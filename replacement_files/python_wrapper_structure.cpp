@@ -32,6 +32,11 @@
 #include "../include/drivers/CSinglezoneDriver.hpp"
 #include "../../Common/include/toolboxes/geometry_toolbox.hpp"
 
+// preCICE: POSIX file access for the checkpoint files
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
 
   int rank = MASTER_NODE;
@@ -214,15 +219,8 @@ unsigned long CDriver::GetNumberVertices(unsigned short iMarker) const {
 
 unsigned long CDriver::GetNumberHaloVertices(unsigned short iMarker) const {
 
-  unsigned long nHaloVertices, iVertex, iPoint;
-
-  nHaloVertices = 0;
-  for(iVertex = 0; iVertex < geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker]; iVertex++){
-    iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
-    if(!(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint))) nHaloVertices += 1;
-  }
-
-  return nHaloVertices;
+  // preCICE: count from the cached physical vertices instead of scanning the marker on every call
+  return geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker] - GetMarkerPhysicalVertices(iMarker).size();
 
 }
 
@@ -247,6 +245,54 @@ bool CDriver::IsAHaloNode(unsigned short iMarker, unsigned long iVertex) const {
 
 }
 
+// preCICE:
+void CDriver::SetMarkerPhysicalVertices() const {
+
+  const CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned short nMarker = geometry->GetnMarker();
+
+  /*--- The lists only depend on the partition, rebuild them only if it changed. ---*/
+  bool rebuild = (geometry != preCICE_VertexCache_Geometry) || (preCICE_VertexCache_nVertex.size() != nMarker);
+  for (unsigned short iMarker = 0; !rebuild && iMarker < nMarker; iMarker++)
+    rebuild = (preCICE_VertexCache_nVertex[iMarker] != geometry->nVertex[iMarker]);
+
+  if (!rebuild) return;
+
+  preCICE_VertexCache_Geometry = geometry;
+  preCICE_VertexCache_nVertex.assign(geometry->nVertex, geometry->nVertex + nMarker);
+  preCICE_PhysicalVertices.assign(nMarker, vector<unsigned long>());
+  preCICE_PhysicalPoints.assign(nMarker, vector<unsigned long>());
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->nodes->GetDomain(iPoint)) {
+        preCICE_PhysicalVertices[iMarker].push_back(iVertex);
+        preCICE_PhysicalPoints[iMarker].push_back(iPoint);
+      }
+    }
+  }
+
+}
+
+// preCICE:
+const vector<unsigned long>& CDriver::GetMarkerPhysicalVertices(unsigned short iMarker) const {
+
+  SetMarkerPhysicalVertices();
+
+  return preCICE_PhysicalVertices[iMarker];
+
+}
+
+// preCICE:
+const vector<unsigned long>& CDriver::GetMarkerPhysicalPoints(unsigned short iMarker) const {
+
+  SetMarkerPhysicalVertices();
+
+  return preCICE_PhysicalPoints[iMarker];
+
+}
+
 vector<passivedouble> CDriver::GetInitialMeshCoord(unsigned short iMarker, unsigned long iVertex) const {
 
   vector<su2double> coord(3,0.0);
@@ -267,6 +313,53 @@ vector<passivedouble> CDriver::GetInitialMeshCoord(unsigned short iMarker, unsig
   return coord_passive;
 }
 
+// preCICE:
+template<unsigned short NDIM>
+void CDriver::GetMarkerInitialCoordinates_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Coords) const {
+
+  const CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  for (unsigned long i = 0; i < vertices.size(); i++) {
+    const auto iPoint = geometry->vertex[iMarker][vertices[i]]->GetNode();
+    const su2double* Coord = geometry->nodes->GetCoord(iPoint);
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+      Coords[i*NDIM + iDim] = SU2_TYPE::GetValue(Coord[iDim]);
+  }
+
+}
+
+// preCICE:
+void CDriver::GetMarkerInitialCoordinates(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Coords) const {
+
+  /*--- Dispatch once per marker, the kernels have a fixed number of components per vertex. ---*/
+  if (nDim == 2) GetMarkerInitialCoordinates_impl<2>(iMarker, vertices, Coords);
+  else GetMarkerInitialCoordinates_impl<3>(iMarker, vertices, Coords);
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerInitialCoordinates(unsigned short iMarker) const {
+
+  const auto& vertices = GetMarkerPhysicalVertices(iMarker);
+  vector<passivedouble> Coords_passive(vertices.size()*nDim, 0.0);
+
+  GetMarkerInitialCoordinates(iMarker, vertices, Coords_passive.data());
+
+  return Coords_passive;
+}
+
+// preCICE:
+vector<unsigned long> CDriver::GetMarkerVertexGlobalIndices(unsigned short iMarker) const {
+
+  const auto& points = GetMarkerPhysicalPoints(iMarker);
+  vector<unsigned long> GlobalIndices(points.size());
+
+  for (unsigned long i = 0; i < points.size(); i++)
+    GlobalIndices[i] = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetGlobalIndex(points[i]);
+
+  return GlobalIndices;
+}
+
 vector<passivedouble> CDriver::GetVertexNormal(unsigned short iMarker, unsigned long iVertex, bool unitNormal) const {
 
   su2double *Normal;
@@ -332,7 +425,26 @@ void CDriver::SetUnsteady_TimeStep(passivedouble val_delta_unsttime) {
 }
 
 // preCICE:
-void CDriver::ReloadOldState() {
+void CDriver::ReloadOldState(unsigned short nWindowsBack) {
+
+  WaitSaveOldState();
+  WaitCheckpointFile();
+  /*--- A swapped out checkpoint that was never copied back may have been modified by the solver. ---*/
+  if (preCICE_CopyOnWrite_Pending)
+    SU2_MPI::Error("CopyOnWriteOldState must be called before the solution is modified after ReloadOldState.",
+                   CURRENT_FUNCTION);
+
+  if (nWindowsBack >= preCICE_nCheckpoint_Saved)
+    SU2_MPI::Error("The requested checkpoint is not available, call SaveOldState first or keep more checkpoints.",
+                   CURRENT_FUNCTION);
+
+  ResizeCheckpointScratch();
+
+  /*--- Rolling back by more than one window discards the newer checkpoints. ---*/
+  const unsigned short nCheckpoint = preCICE_Checkpoints.size();
+  preCICE_Checkpoint_Last = (preCICE_Checkpoint_Last + nCheckpoint - nWindowsBack) % nCheckpoint;
+  preCICE_nCheckpoint_Saved -= nWindowsBack;
+  CPreciceCheckpoint& checkpoint = preCICE_Checkpoints[preCICE_Checkpoint_Last];
 
   // Get the number of solution variables, points, and dimension
   const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
@@ -347,58 +459,168 @@ void CDriver::ReloadOldState() {
   const bool dynamic_grid = config_container[ZONE_0]->GetDynamic_Grid();
   const unsigned short MESH_nVar = (dynamic_grid) ? solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetnVar() : 0;
 
-  /*--- To make this routine safe to call in parallel most of it can only be executed by one thread. ---*/
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+  CVariable *FLOW_nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+  CVariable *TURB_nodes = (rans) ? solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes() : nullptr;
+  CVariable *MESH_nodes = (dynamic_grid) ? solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes() : nullptr;
+  CPoint *nodes = geometry_container[ZONE_0][INST_0][MESH_0]->nodes;
 
-  // Loop through everything and set all necessary variables to current state
-  for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++) {
+  /*--- Levels n that were identical to the solution when saved are only stored once. ---*/
+  const auto& FLOW_time_n = (checkpoint.Solution_time_n_IsSolution) ? checkpoint.Solution : checkpoint.Solution_time_n;
+  const auto& TURB_time_n = (checkpoint.TURB_Solution_time_n_IsSolution) ? checkpoint.TURB_Solution : checkpoint.TURB_Solution_time_n;
+  const auto& MESH_time_n = (checkpoint.MESH_Solution_time_n_IsSolution) ? checkpoint.MESH_Solution : checkpoint.MESH_Solution_time_n;
+  const auto& Volume_n = (checkpoint.Volume_n_IsVolume) ? checkpoint.Volume : checkpoint.Volume_n;
+
+  /*--- In the minimal mode the coordinates (reference mesh plus displacement) and the grid velocity (from the
+   *    displacement levels, as in FinalizeMESH_SOL) are derived, the volume is recomputed by UpdateGeometry. ---*/
+  const bool derive_geometry = preCICE_CheckpointMinimal;
+  const bool firstOrder = config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST;
+  const bool secondOrder = config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+  const su2double invTimeStep = 1.0 / config_container[ZONE_0]->GetDelta_UnstTimeND();
+
+  /*--- Only an uncompressed solution in working precision, with all points, can be swapped into the solver. ---*/
+  const bool swap_solution = preCICE_CheckpointSwap && !checkpoint.Solution.IsSingle && !checkpoint.Solution.IsCompressed &&
+                             (checkpoint.Solution.nPoint == geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint());
+
+  /*--- The solution levels may include the halo points. ---*/
+  const unsigned long nPoint_Saved = checkpoint.Solution.nPoint;
+
+  /*--- Every point is restored independently, so all threads share the work. ---*/
+  SU2_OMP_PARALLEL {
+
+    if (!swap_solution) LoadCheckpointBuffer(nPoint_Saved*nVar, checkpoint.Solution, FLOW_nodes->GetSolution().data());
+    LoadCheckpointBuffer(nPoint_Saved*nVar, FLOW_time_n, FLOW_nodes->GetSolution_time_n().data());
+    LoadCheckpointBuffer(nPoint_Saved*nVar, checkpoint.Solution_time_n1, FLOW_nodes->GetSolution_time_n1().data());
 
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->SetSolution(iPoint_Local, iVar, preCICE_Solution(iPoint_Local, iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->Set_Solution_time_n(iPoint_Local, iVar, preCICE_Solution_time_n(iPoint_Local, iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->Set_Solution_time_n1(iPoint_Local, iVar, preCICE_Solution_time_n1(iPoint_Local, iVar));
-    }
     if (rans) {
-      for (unsigned short TURB_iVar = 0; TURB_iVar < TURB_nVar; TURB_iVar++) {
-        solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->SetSolution(iPoint_Local, TURB_iVar, preCICE_TURB_Solution(iPoint_Local, TURB_iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->Set_Solution_time_n(iPoint_Local, TURB_iVar, preCICE_TURB_Solution_time_n(iPoint_Local, TURB_iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->Set_Solution_time_n1(iPoint_Local, TURB_iVar, preCICE_TURB_Solution_time_n1(iPoint_Local, TURB_iVar));
-      }
-    }    
-    if (dynamic_grid) {
+      LoadCheckpointBuffer(nPoint_Saved*TURB_nVar, checkpoint.TURB_Solution, TURB_nodes->GetSolution().data());
+      LoadCheckpointBuffer(nPoint_Saved*TURB_nVar, TURB_time_n, TURB_nodes->GetSolution_time_n().data());
+      LoadCheckpointBuffer(nPoint_Saved*TURB_nVar, checkpoint.TURB_Solution_time_n1, TURB_nodes->GetSolution_time_n1().data());
+    }
+
+    for (auto iScalar = 0u; iScalar < preCICE_ScalarSolvers.size(); iScalar++) {
+      CSolver *SCALAR_solver = solver_container[ZONE_0][INST_0][MESH_0][preCICE_ScalarSolvers[iScalar]];
+      CVariable *SCALAR_nodes = SCALAR_solver->GetNodes();
+      const unsigned long size = nPoint_Saved*SCALAR_solver->GetnVar();
+      const auto& levels = checkpoint.SCALAR[iScalar];
+      const auto& SCALAR_time_n = (levels.Solution_time_n_IsSolution) ? levels.Solution : levels.Solution_time_n;
 
-      for (unsigned short MESH_iVar = 0; MESH_iVar < MESH_nVar; MESH_iVar++) {
-        solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->SetSolution(iPoint_Local, MESH_iVar, preCICE_MESH_Solution(iPoint_Local, MESH_iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Set_Solution_time_n(iPoint_Local, MESH_iVar, preCICE_MESH_Solution_time_n(iPoint_Local, MESH_iVar));
-        solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Set_Solution_time_n1(iPoint_Local, MESH_iVar, preCICE_MESH_Solution_time_n1(iPoint_Local, MESH_iVar));
+      LoadCheckpointBuffer(size, levels.Solution, SCALAR_nodes->GetSolution().data());
+      LoadCheckpointBuffer(size, SCALAR_time_n, SCALAR_nodes->GetSolution_time_n().data());
+      LoadCheckpointBuffer(size, levels.Solution_time_n1, SCALAR_nodes->GetSolution_time_n1().data());
+    }
+
+    if (dynamic_grid) {
+      LoadCheckpointBuffer(nPoint_Saved*MESH_nVar, checkpoint.MESH_Solution, MESH_nodes->GetSolution().data());
+      LoadCheckpointBuffer(nPoint_Saved*MESH_nVar, MESH_time_n, MESH_nodes->GetSolution_time_n().data());
+      LoadCheckpointBuffer(nPoint_Saved*MESH_nVar, checkpoint.MESH_Solution_time_n1, MESH_nodes->GetSolution_time_n1().data());
+
+      /*--- CPoint only exposes Volume per point, Volume_n and Volume_nM1 are shifted for all points at
+       *    once (Volume -> Volume_n -> Volume_nM1). Restore the oldest level first, then shift it back. ---*/
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Local, omp_get_max_threads()))
+      for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          if (derive_geometry) {
+            const su2double Disp_nM1 = MESH_nodes->GetSolution_time_n1(iPoint_Local, iDim);
+            const su2double Disp_n = MESH_nodes->GetSolution_time_n(iPoint_Local, iDim);
+            const su2double Disp_nP1 = MESH_nodes->GetSolution(iPoint_Local, iDim);
+
+            su2double GridVel = 0.0;
+            if (firstOrder)
+              GridVel = (Disp_nP1 - Disp_n) * invTimeStep;
+            else if (secondOrder)
+              GridVel = (1.5*Disp_nP1 - 2.0*Disp_n + 0.5*Disp_nM1) * invTimeStep;
+
+            nodes->SetCoord(iPoint_Local, iDim, MESH_nodes->GetMesh_Coord(iPoint_Local, iDim) + Disp_nP1);
+            nodes->SetGridVel(iPoint_Local, iDim, GridVel);
+          } else {
+            nodes->SetCoord(iPoint_Local, iDim, checkpoint.Coord.Get(iPoint_Local, iDim));
+            nodes->SetGridVel(iPoint_Local, iDim, checkpoint.GridVel.Get(iPoint_Local, iDim));
+          }
+        }
+        nodes->SetVolume(iPoint_Local, checkpoint.Volume_nM1.Get(iPoint_Local, 0));
       }
+      END_SU2_OMP_FOR
 
-      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-        geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetCoord(iPoint_Local,iDim, preCICE_Coord(iPoint_Local,iDim));
-        geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, preCICE_GridVel(iPoint_Local, iDim));
+      nodes->SetVolume_n();
+      nodes->SetVolume_nM1();
+
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Local, omp_get_max_threads()))
+      for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++)
+        nodes->SetVolume(iPoint_Local, Volume_n.Get(iPoint_Local, 0));
+      END_SU2_OMP_FOR
+
+      nodes->SetVolume_n();
+
+      if (!derive_geometry) {
+        SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Local, omp_get_max_threads()))
+        for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++)
+          nodes->SetVolume(iPoint_Local, checkpoint.Volume.Get(iPoint_Local, 0));
+        END_SU2_OMP_FOR
       }
-      
-      
-      //Temporarily must set volume and then set appropriate n, n1, then reset Volume
-      // Order may seem awkward, but look at CPoint::SetVolume_____ functions to understand why
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume(iPoint_Local, preCICE_Volume_nM1(iPoint_Local));
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume_n();
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume_nM1();
-
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume(iPoint_Local, preCICE_Volume_n(iPoint_Local));
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume_n();
-
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetVolume(iPoint_Local, preCICE_Volume(iPoint_Local));
     }
+  }
+  END_SU2_OMP_PARALLEL
 
+  /*--- The level n may be aliased to the saved solution, hence the swap only after it was restored. ---*/
+  if (swap_solution) {
+    swap(FLOW_nodes->GetSolution(), checkpoint.Solution.Double);
+    preCICE_CopyOnWrite_Pending = true;
   }
 
-  }  // end safe global access, pre and postprocessing are thread-safe.
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  /*--- Coarse multigrid levels, with halos, as they were saved. ---*/
+  if (preCICE_CheckpointMultigrid) {
+    for (auto iMesh = 1u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+      const unsigned long nPoint_Coarse = geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint();
+      CVariable *FLOW_coarse = solver_container[ZONE_0][INST_0][iMesh][FLOW_SOL]->GetNodes();
+      CVariable *TURB_coarse = (rans) ? solver_container[ZONE_0][INST_0][iMesh][TURB_SOL]->GetNodes() : nullptr;
+
+      SU2_OMP_PARALLEL {
+        LoadCheckpointBuffer(nPoint_Coarse*nVar, checkpoint.MG_Solution[iMesh-1], FLOW_coarse->GetSolution().data());
+        LoadCheckpointBuffer(nPoint_Coarse*nVar, checkpoint.MG_Solution_time_n[iMesh-1], FLOW_coarse->GetSolution_time_n().data());
+        LoadCheckpointBuffer(nPoint_Coarse*nVar, checkpoint.MG_Solution_time_n1[iMesh-1], FLOW_coarse->GetSolution_time_n1().data());
+
+        if (rans) {
+          LoadCheckpointBuffer(nPoint_Coarse*TURB_nVar, checkpoint.MG_TURB_Solution[iMesh-1], TURB_coarse->GetSolution().data());
+
+          SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Coarse, omp_get_max_threads()))
+          for (unsigned long iPoint = 0; iPoint < nPoint_Coarse; iPoint++)
+            TURB_coarse->SetmuT(iPoint, checkpoint.MG_TURB_muT[iMesh-1].Get(iPoint, 0));
+          END_SU2_OMP_FOR
+        }
+      }
+      END_SU2_OMP_PARALLEL
+    }
+  }
 
   FinalizeFLOW_SOL();
   if (rans) FinalizeTURB_SOL();
+  for (auto iSol : preCICE_ScalarSolvers) FinalizeSCALAR_SOL(iSol);
   if (dynamic_grid) FinalizeMESH_SOL();
+
+  /*--- Compare the derived geometry with the stored one. ---*/
+  if (dynamic_grid && derive_geometry && preCICE_CheckpointVerify) {
+
+    passivedouble MaxDiff[2] = {0.0, 0.0};
+    SU2_OMP_PARALLEL {
+      passivedouble myDiff[2] = {0.0, 0.0};
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Local, omp_get_max_threads()))
+      for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          myDiff[0] = max(myDiff[0], fabs(SU2_TYPE::GetValue(nodes->GetCoord(iPoint_Local, iDim) - checkpoint.Coord.Get(iPoint_Local, iDim))));
+        myDiff[1] = max(myDiff[1], fabs(SU2_TYPE::GetValue(nodes->GetVolume(iPoint_Local) - checkpoint.Volume.Get(iPoint_Local, 0))));
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_CRITICAL {
+        MaxDiff[0] = max(MaxDiff[0], myDiff[0]);
+        MaxDiff[1] = max(MaxDiff[1], myDiff[1]);
+      }
+      END_SU2_OMP_CRITICAL
+    }
+    END_SU2_OMP_PARALLEL
+
+    SU2_MPI::Allreduce(MaxDiff, preCICE_CheckpointVerifyError.data(), 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  }
 }
 
 //preCICE: Finalize FLOW reloads
@@ -411,9 +633,21 @@ void CDriver::FinalizeFLOW_SOL() {
   bool dynamic_grid = config_container[ZONE_0]->GetDynamic_Grid();
 
 
-  /*--- Update the geometry for flows on deforming meshes. ---*/
+  /*--- Update the geometry for flows on deforming meshes. The saved metrics replace the rebuild, except on
+   *    the first reload, which measures what the rebuild costs. ---*/
   if (dynamic_grid) {
-    CGeometry::UpdateGeometry(geometry_container[ZONE_0][INST_0], config_container[ZONE_0]);
+    const bool reuse_metrics = preCICE_CheckpointMetrics && (preCICE_CheckpointGeometryTime[1] > 0.0);
+    const passivedouble StartTime = SU2_MPI::Wtime();
+
+    if (reuse_metrics) {
+      geometry_container[ZONE_0][INST_0][MESH_0]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], COORDINATES);
+      geometry_container[ZONE_0][INST_0][MESH_0]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], COORDINATES);
+      LoadGeometryMetrics(preCICE_Checkpoints[preCICE_Checkpoint_Last]);
+    }
+    else {
+      CGeometry::UpdateGeometry(geometry_container[ZONE_0][INST_0], config_container[ZONE_0]);
+    }
+    preCICE_CheckpointGeometryTime[(reuse_metrics) ? 0 : 1] = SU2_MPI::Wtime() - StartTime;
 
     for (auto iMesh = 0u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
 
@@ -431,8 +665,10 @@ void CDriver::FinalizeFLOW_SOL() {
    on the fine level in order to have all necessary quantities updated,
    especially if this is a turbulent simulation (eddy viscosity). ---*/
 
-  solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
-  solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+  if (!preCICE_Checkpoint_WithHalo) {
+    solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+    solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+  }
 
   /*--- For turbulent/species simulations the flow preprocessing is done by the turbulence/species solver
    *    after it loads its variables (they are needed to compute flow primitives). In case turbulence and species, the
@@ -442,7 +678,10 @@ void CDriver::FinalizeFLOW_SOL() {
     solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->Preprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
   }
 
-    /*--- Interpolate the solution down to the coarse multigrid levels ---*/
+    /*--- Interpolate the solution down to the coarse multigrid levels, unless they were reloaded from the checkpoint.
+   *    Their primitive variables are recomputed by the multigrid cycle before they are used. ---*/
+
+  if (preCICE_CheckpointMultigrid) return;
 
   for (auto iMesh = 1u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
     CSolver::MultigridRestriction(*geometry_container[ZONE_0][INST_0][iMesh - 1], solver_container[ZONE_0][INST_0][iMesh - 1][FLOW_SOL]->GetNodes()->GetSolution(),
@@ -459,21 +698,23 @@ void CDriver::FinalizeFLOW_SOL() {
 
 // preCICE: Finalize TURB reloads
 void CDriver::FinalizeTURB_SOL() {
-  /*--- MPI solution and compute the eddy viscosity ---*/
-  solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
-  solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+  /*--- MPI solution (unless the halos were reloaded) and compute the eddy viscosity ---*/
+  if (!preCICE_Checkpoint_WithHalo) {
+    solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+    solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+  }
 
-  /*--- For turbulent+species simulations the solver Pre-/Postprocessing is done by the species/transition solver. ---*/
+  /*--- For turbulent+species simulations the solver Pre-/Postprocessing is done by the species/transition solver (FinalizeSCALAR_SOL). ---*/
   if (config_container[ZONE_0]->GetKind_Species_Model() == SPECIES_MODEL::NONE && config_container[ZONE_0]->GetKind_Trans_Model() == TURB_TRANS_MODEL::NONE) {
     solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->Preprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], MESH_0, NO_RK_ITER,
                                             RUNTIME_FLOW_SYS, false);
     solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->Postprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], MESH_0);
-  } else {
-    SU2_MPI::Error("Invalid configuration for using implicit coupling! Species and transition models not implemented.", CURRENT_FUNCTION);
-    return;
   }
 
-  /*--- Interpolate the solution down to the coarse multigrid levels ---*/
+  /*--- Interpolate the solution down to the coarse multigrid levels, unless they were reloaded from the checkpoint
+   *    (with the eddy viscosity). ---*/
+
+  if (preCICE_CheckpointMultigrid) return;
 
   for (auto iMesh = 1u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
     CSolver::MultigridRestriction(*geometry_container[ZONE_0][INST_0][iMesh - 1], solver_container[ZONE_0][INST_0][iMesh - 1][TURB_SOL]->GetNodes()->GetSolution(),
@@ -489,99 +730,695 @@ void CDriver::FinalizeTURB_SOL() {
   }
 } 
 
+// preCICE: Finalize reloads of the other active solvers
+void CDriver::FinalizeSCALAR_SOL(unsigned short iSol) {
+
+  const bool rans = config_container[ZONE_0]->GetKind_Turb_Model() != TURB_MODEL::NONE;
+  const bool species = config_container[ZONE_0]->GetKind_Species_Model() != SPECIES_MODEL::NONE;
+
+  /*--- MPI solution, unless the halos were reloaded ---*/
+  if (!preCICE_Checkpoint_WithHalo) {
+    solver_container[ZONE_0][INST_0][MESH_0][iSol]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+    solver_container[ZONE_0][INST_0][MESH_0][iSol]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+  }
+
+  /*--- The flow preprocessing needs the species variables, and the eddy viscosity the transition variables. In case
+   *    species are active the species solver does all the Pre-/Postprocessing, otherwise the transition solver. All
+   *    solvers are loaded before they are finalized. ---*/
+  if ((iSol == SPECIES_SOL) || ((iSol == TRANS_SOL) && !species)) {
+    solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->Preprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], MESH_0, NO_RK_ITER,
+                                            RUNTIME_FLOW_SYS, false);
+    if (rans)
+      solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->Postprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], MESH_0);
+  }
+
+  /*--- Interpolate the solution down to the coarse multigrid levels that have this solver. ---*/
+  for (auto iMesh = 1u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    if (solver_container[ZONE_0][INST_0][iMesh][iSol] == nullptr) break;
+
+    CSolver::MultigridRestriction(*geometry_container[ZONE_0][INST_0][iMesh - 1], solver_container[ZONE_0][INST_0][iMesh - 1][iSol]->GetNodes()->GetSolution(),
+                        *geometry_container[ZONE_0][INST_0][iMesh], solver_container[ZONE_0][INST_0][iMesh][iSol]->GetNodes()->GetSolution());
+    solver_container[ZONE_0][INST_0][iMesh][iSol]->InitiateComms(geometry_container[ZONE_0][INST_0][iMesh], config_container[ZONE_0], SOLUTION);
+    solver_container[ZONE_0][INST_0][iMesh][iSol]->CompleteComms(geometry_container[ZONE_0][INST_0][iMesh], config_container[ZONE_0], SOLUTION);
+  }
+}
+
 // preCICE: Finalize MESH reloads
 void CDriver::FinalizeMESH_SOL() {
 
   // Get the number of solution points and dimension
   const unsigned long nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
   const unsigned short nDim = geometry_container[ZONE_0][INST_0][MESH_0]->GetnDim();
-  
-  /*--- Communicate the loaded displacements. ---*/
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
-
-  /*--- Init the linear system solution. ---*/
-  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
-    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
-      solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->LinSysSol(iPoint, iDim) = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution(iPoint, iDim);
-    }
-  }
 
-  /*--- For time-domain problems, we need to compute the grid velocities. ---*/
-  
-  /*--- Update the old geometry (coordinates n and n-1) ---*/
+  CSolver *MESH_solver = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL];
+  CVariable *MESH_nodes = MESH_solver->GetNodes();
+  CPoint *nodes = geometry_container[ZONE_0][INST_0][MESH_0]->nodes;
+
+  /*--- Communicate the loaded displacements and the old geometry (coordinates n and n-1), unless the halos were reloaded. ---*/
   //Only relevant functions from RestartOldGeometry pasted below
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N);
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N);
-  
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N1);
-  solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N1);
+  if (!preCICE_Checkpoint_WithHalo) {
+    MESH_solver->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+    MESH_solver->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION);
+
+    MESH_solver->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N);
+    MESH_solver->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N);
 
+    MESH_solver->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N1);
+    MESH_solver->CompleteComms(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0], SOLUTION_TIME_N1);
+  }
 
   /*--- Once Displacement_n and Displacement_n1 are filled we can compute the Grid Velocity ---*/
-  /*--- Compute the velocity of each node. ---*/
 
   const bool firstOrder = config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST;
   const bool secondOrder = config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
   const su2double invTimeStep = 1.0 / config_container[ZONE_0]->GetDelta_UnstTimeND();
 
-  //SU2_OMP_FOR_STAT(omp_chunk_size) - omp_chunk_size part of CMeshSolver
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+  /*--- Points of the deforming and moving markers, for the Bound_Disp variable. ---*/
+  const vector<unsigned long>& DeformPoints = GetDeformMarkerPoints();
+  const unsigned long nDeformPoint = DeformPoints.size();
+
+  SU2_OMP_PARALLEL {
+
+    /*--- Init the linear system solution and compute the velocity of each node in one pass. ---*/
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+      /*--- Coordinates of the current point at n+1, n, & n-1 time levels. ---*/
 
-    /*--- Coordinates of the current point at n+1, n, & n-1 time levels. ---*/
+      const su2double* Disp_nM1 = MESH_nodes->GetSolution_time_n1(iPoint);
+      const su2double* Disp_n   = MESH_nodes->GetSolution_time_n(iPoint);
+      const su2double* Disp_nP1 = MESH_nodes->GetSolution(iPoint);
 
-    const su2double* Disp_nM1 = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution_time_n1(iPoint);
-    const su2double* Disp_n   = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution_time_n(iPoint);
-    const su2double* Disp_nP1 = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution(iPoint);
+      /*--- Compute mesh velocity for this point with 1st or 2nd-order approximation. ---*/
 
-    /*--- Compute mesh velocity for this point with 1st or 2nd-order approximation. ---*/
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
 
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        MESH_solver->LinSysSol(iPoint, iDim) = Disp_nP1[iDim];
 
-      su2double GridVel = 0.0;
-      if (firstOrder)
-        GridVel = (Disp_nP1[iDim] - Disp_n[iDim]) * invTimeStep;
-      else if (secondOrder)
-        GridVel = (1.5*Disp_nP1[iDim] - 2.0*Disp_n[iDim] + 0.5*Disp_nM1[iDim]) * invTimeStep;
+        su2double GridVel = 0.0;
+        if (firstOrder)
+          GridVel = (Disp_nP1[iDim] - Disp_n[iDim]) * invTimeStep;
+        else if (secondOrder)
+          GridVel = (1.5*Disp_nP1[iDim] - 2.0*Disp_n[iDim] + 0.5*Disp_nM1[iDim]) * invTimeStep;
 
-      geometry_container[ZONE_0][INST_0][MESH_0]->nodes->SetGridVel(iPoint, iDim, GridVel);
+        nodes->SetGridVel(iPoint, iDim, GridVel);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    /*--- Store the boundary displacements at the Bound_Disp variable. ---*/
+    if (nDeformPoint > 0) {
+      SU2_OMP_FOR_STAT(roundUpDiv(nDeformPoint, omp_get_max_threads()))
+      for (unsigned long iDeformPoint = 0; iDeformPoint < nDeformPoint; iDeformPoint++) {
+        const auto iNode = DeformPoints[iDeformPoint];
+        MESH_nodes->SetBound_Disp(iNode, MESH_nodes->GetSolution(iNode));
+      }
+      END_SU2_OMP_FOR
     }
   }
-  //END_SU2_OMP_FOR
+  END_SU2_OMP_PARALLEL
 
   for (auto iMGlevel = 1u; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++)
     geometry_container[ZONE_0][INST_0][iMGlevel]->SetRestricted_GridVelocity(geometry_container[ZONE_0][INST_0][iMGlevel-1]);
 
+}
+
+// preCICE:
+const vector<unsigned long>& CDriver::GetDeformMarkerPoints() {
 
+  const CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
-  /*--- Store the boundary displacements at the Bound_Disp variable. ---*/
-  for (unsigned short iMarker = 0; iMarker < config_container[ZONE_0]->GetnMarker_All(); iMarker++) {
+  /*--- The markers do not change when the mesh deforms, build the list once per geometry. ---*/
+  if (geometry == preCICE_DeformCache_Geometry) return preCICE_DeformPoints;
 
+  preCICE_DeformCache_Geometry = geometry;
+  preCICE_DeformPoints.clear();
+
+  for (unsigned short iMarker = 0; iMarker < config_container[ZONE_0]->GetnMarker_All(); iMarker++) {
     if ((config_container[ZONE_0]->GetMarker_All_Deform_Mesh(iMarker) == YES) ||
         (config_container[ZONE_0]->GetMarker_All_Moving(iMarker) == YES)) {
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        preCICE_DeformPoints.push_back(geometry->vertex[iMarker][iVertex]->GetNode());
+    }
+  }
+
+  /*--- Points shared by several markers are listed once, so that threads never write the same point. ---*/
+  sort(preCICE_DeformPoints.begin(), preCICE_DeformPoints.end());
+  preCICE_DeformPoints.erase(unique(preCICE_DeformPoints.begin(), preCICE_DeformPoints.end()), preCICE_DeformPoints.end());
+
+  return preCICE_DeformPoints;
 
-      for (unsigned long iVertex = 0; iVertex < geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker]; iVertex++) {
+}
+
+namespace {
+
+/*--- preCICE: Lossless compression of checkpoint blocks. The bits of each value are XOR-ed with the same
+ *    variable of the previous point (delta), the bytes are grouped by significance (shuffle), and the runs
+ *    of zero bytes, which dominate the high bytes of smooth fields, are collapsed. A plane is coded as
+ *    tokens: c < 128 is followed by c+1 literal bytes, c >= 128 stands for c-127 zero bytes. ---*/
+
+inline uint64_t ValueBits(const su2double& val) {
+  const passivedouble value = SU2_TYPE::GetValue(val);
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+void CompressPlane(const uint8_t* plane, unsigned long size, vector<uint8_t>& out) {
+  unsigned long i = 0;
+  while (i < size) {
+    unsigned long run = 0;
+    if (plane[i] == 0) {
+      while ((i + run < size) && (run < 128) && (plane[i + run] == 0)) run++;
+      out.push_back(static_cast<uint8_t>(127 + run));
+    } else {
+      /*--- A single zero is cheaper as a literal than as a token. ---*/
+      while ((i + run < size) && (run < 128) &&
+             ((plane[i + run] != 0) || ((i + run + 1 < size) && (plane[i + run + 1] != 0)))) run++;
+      out.push_back(static_cast<uint8_t>(run - 1));
+      out.insert(out.end(), plane + i, plane + i + run);
+    }
+    i += run;
+  }
+}
+
+/*--- Returns the end of the plane in the input, or nullptr if the tokens do not fit the input or the plane. ---*/
+const uint8_t* DecompressPlane(const uint8_t* in, const uint8_t* end, unsigned long size, uint8_t* plane) {
+  unsigned long i = 0;
+  while (i < size) {
+    if (in >= end) return nullptr;
+    const unsigned long token = *in++;
+    const unsigned long len = (token < 128) ? token + 1 : token - 127;
+    if (len > size - i) return nullptr;
+    if (token < 128) {
+      if (len > static_cast<unsigned long>(end - in)) return nullptr;
+      memcpy(plane + i, in, len);
+      in += len;
+    } else {
+      memset(plane + i, 0, len);
+    }
+    i += len;
+  }
+  return in;
+}
+
+/*--- Upper bound of the compressed size of a block of size values, a token covers at least one byte. ---*/
+inline unsigned long MaxCompressedSize(unsigned long size) { return sizeof(uint64_t)*2*size; }
+
+void CompressBlock(const su2double* src, unsigned long nPoint, unsigned long nVar, vector<uint8_t>& scratch,
+                   vector<uint8_t>& out) {
+  const unsigned long size = nPoint*nVar;
+  scratch.resize(sizeof(uint64_t)*size);
+
+  for (unsigned long i = 0; i < size; i++) {
+    uint64_t bits = ValueBits(src[i]);
+    if (i >= nVar) bits ^= ValueBits(src[i - nVar]);
+    for (unsigned short iByte = 0; iByte < sizeof(uint64_t); iByte++)
+      scratch[iByte*size + i] = (bits >> (8*iByte)) & 0xFF;
+  }
+
+  out.clear();
+  for (unsigned short iByte = 0; iByte < sizeof(uint64_t); iByte++)
+    CompressPlane(&scratch[iByte*size], size, out);
+}
+
+/*--- Returns false if the block is malformed, dst is then not written. ---*/
+bool DecompressBlock(const vector<uint8_t>& in, unsigned long nPoint, unsigned long nVar, vector<uint8_t>& scratch,
+                     su2double* dst) {
+  const unsigned long size = nPoint*nVar;
+  scratch.resize(sizeof(uint64_t)*size);
+
+  const uint8_t* pos = in.data();
+  const uint8_t* end = pos + in.size();
+  for (unsigned short iByte = 0; (iByte < sizeof(uint64_t)) && (pos != nullptr); iByte++)
+    pos = DecompressPlane(pos, end, size, &scratch[iByte*size]);
+  if (pos != end) return false;
+
+  /*--- The previous point is already restored, so the values are written straight into the destination. ---*/
+  for (unsigned long i = 0; i < size; i++) {
+    uint64_t bits = 0;
+    for (unsigned short iByte = 0; iByte < sizeof(uint64_t); iByte++)
+      bits |= uint64_t(scratch[iByte*size + i]) << (8*iByte);
+    if (i >= nVar) bits ^= ValueBits(dst[i - nVar]);
+    passivedouble value;
+    memcpy(&value, &bits, sizeof(value));
+    dst[i] = value;
+  }
+  return true;
+}
+
+/*--- preCICE: Header of the per-rank checkpoint files. It is followed by the buffers of the checkpoint,
+ *    each as nPoint, nVar, IsSingle, IsCompressed, number of blocks, then either the values (in the
+ *    precision they are stored with) or, for each compressed block, its size and its bytes, and last
+ *    the checksum of these values or blocks. ---*/
+struct CheckpointFileHeader {
+  char Magic[8] = {'S', 'U', '2', 'P', 'C', 'C', 'K', '\0'};
+  uint64_t Version = 3;
+  uint64_t nRank = 0;
+  uint64_t nBuffer = 0;
+  uint64_t TimeWindow = 0;
+  uint64_t TimeIter = 0;
+  uint64_t IsSolution = 0;   /*!< \brief Aliased levels, one bit each for FLOW, TURB, MESH, Volume and the other solvers. */
+};
+
+/*--- Checksum of the data of a buffer (FNV-1a on 64-bit words), to detect damaged checkpoint files. ---*/
+void UpdateChecksum(uint64_t& hash, const void* data, size_t size) {
+  const uint64_t prime = 0x100000001b3ULL;
+  const uint8_t* ptr = static_cast<const uint8_t*>(data);
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), ptr += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, ptr, sizeof(word));
+    hash = (hash ^ word) * prime;
+  }
+  for (; size > 0; size--, ptr++) hash = (hash ^ *ptr) * prime;
+}
+
+const uint64_t ChecksumSeed = 0xcbf29ce484222325ULL;
+
+/*--- pwrite and pread may transfer less than requested, repeat until all bytes are done. ---*/
+bool WriteAt(int fd, const void* data, size_t size, off_t& offset) {
+  const char* ptr = static_cast<const char*>(data);
+  while (size > 0) {
+    const ssize_t n = pwrite(fd, ptr, size, offset);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    ptr += n; size -= n; offset += n;
+  }
+  return true;
+}
+
+bool ReadAt(int fd, void* data, size_t size, off_t& offset) {
+  char* ptr = static_cast<char*>(data);
+  while (size > 0) {
+    const ssize_t n = pread(fd, ptr, size, offset);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    ptr += n; size -= n; offset += n;
+  }
+  return true;
+}
+
+} // namespace
+
+// preCICE:
+vector<CDriver::CPreciceCheckpointBuffer*> CDriver::GetCheckpointBuffers(CPreciceCheckpoint& checkpoint) {
+
+  vector<CPreciceCheckpointBuffer*> buffers = {
+    &checkpoint.Solution, &checkpoint.Solution_time_n, &checkpoint.Solution_time_n1,
+    &checkpoint.TURB_Solution, &checkpoint.TURB_Solution_time_n, &checkpoint.TURB_Solution_time_n1,
+    &checkpoint.MESH_Solution, &checkpoint.MESH_Solution_time_n, &checkpoint.MESH_Solution_time_n1,
+    &checkpoint.Coord, &checkpoint.GridVel, &checkpoint.Volume, &checkpoint.Volume_n, &checkpoint.Volume_nM1,
+    &checkpoint.Metrics_MaxLength};
+
+  for (auto& levels : checkpoint.SCALAR) {
+    buffers.push_back(&levels.Solution);
+    buffers.push_back(&levels.Solution_time_n);
+    buffers.push_back(&levels.Solution_time_n1);
+  }
 
-        /*--- Get node index. ---*/
-        auto iNode = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  for (auto* levels : {&checkpoint.MG_Solution, &checkpoint.MG_Solution_time_n, &checkpoint.MG_Solution_time_n1,
+                       &checkpoint.MG_TURB_Solution, &checkpoint.MG_TURB_muT, &checkpoint.Metrics_Coord,
+                       &checkpoint.Metrics_Volume, &checkpoint.Metrics_Edge_Normal, &checkpoint.Metrics_Vertex_Normal}) {
+    for (auto& buffer : *levels) buffers.push_back(&buffer);
+  }
+  return buffers;
+}
 
-        /*--- Set boundary solution. ---*/
-        solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->SetBound_Disp(iNode, solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution(iNode));
+// preCICE:
+string CDriver::WriteCheckpointFile(CPreciceCheckpoint& checkpoint, const string& filename) {
+
+  /*--- Write to a temporary file first, the previous file stays valid until the new one is complete. ---*/
+  const string tmp_filename = filename + ".tmp";
+  const int fd = open(tmp_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return "Could not open " + tmp_filename + " for writing.";
+
+  const auto buffers = GetCheckpointBuffers(checkpoint);
+
+  CheckpointFileHeader header;
+  header.nRank = SU2_MPI::GetSize();
+  header.nBuffer = buffers.size();
+  header.TimeWindow = checkpoint.TimeWindow;
+  header.TimeIter = checkpoint.TimeIter;
+  header.IsSolution = checkpoint.Solution_time_n_IsSolution | (checkpoint.TURB_Solution_time_n_IsSolution << 1) |
+                      (checkpoint.MESH_Solution_time_n_IsSolution << 2) | (checkpoint.Volume_n_IsVolume << 3);
+  for (auto iScalar = 0u; iScalar < checkpoint.SCALAR.size(); iScalar++)
+    header.IsSolution |= uint64_t(checkpoint.SCALAR[iScalar].Solution_time_n_IsSolution) << (4 + iScalar);
+
+  off_t offset = 0;
+  bool ok = WriteAt(fd, &header, sizeof(header), offset);
+
+  for (const auto* buffer : buffers) {
+    const uint64_t Record[5] = {buffer->nPoint, buffer->nVar, buffer->IsSingle, buffer->IsCompressed, buffer->Blocks.size()};
+    ok = ok && WriteAt(fd, Record, sizeof(Record), offset);
+
+    uint64_t checksum = ChecksumSeed;
+    if (buffer->IsCompressed) {
+      for (const auto& block : buffer->Blocks) {
+        const uint64_t nByte = block.size();
+        UpdateChecksum(checksum, &nByte, sizeof(nByte));
+        UpdateChecksum(checksum, block.data(), nByte);
+        ok = ok && WriteAt(fd, &nByte, sizeof(nByte), offset) && WriteAt(fd, block.data(), nByte, offset);
       }
     }
+    else if (buffer->IsSingle) {
+      const size_t nByte = buffer->nPoint*buffer->nVar*sizeof(float);
+      UpdateChecksum(checksum, buffer->Single.data(), nByte);
+      ok = ok && WriteAt(fd, buffer->Single.data(), nByte, offset);
+    }
+    else {
+      const size_t nByte = buffer->nPoint*buffer->nVar*sizeof(su2double);
+      UpdateChecksum(checksum, buffer->Double.data(), nByte);
+      ok = ok && WriteAt(fd, buffer->Double.data(), nByte, offset);
+    }
+    ok = ok && WriteAt(fd, &checksum, sizeof(checksum), offset);
   }
 
+  ok = ok && (fsync(fd) == 0);
+  ok = (close(fd) == 0) && ok;
+  if (!ok) return "Could not write " + tmp_filename + ".";
+
+  if (rename(tmp_filename.c_str(), filename.c_str()) != 0) return "Could not rename " + tmp_filename + " to " + filename + ".";
+  return "";
 }
 
 // preCICE:
-void CDriver::SaveOldState() {
+string CDriver::ReadCheckpointFile(CPreciceCheckpoint& checkpoint, const string& filename) {
 
-  // Get the number of solution variables, points, and dimension
-  // Problem: am looping through global number of points and indexing as such. Not local.
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return "Could not open " + filename + ".";
+
+  const auto buffers = GetCheckpointBuffers(checkpoint);
+
+  const CheckpointFileHeader expected;
+  CheckpointFileHeader header;
+  off_t offset = 0;
+  bool ok = ReadAt(fd, &header, sizeof(header), offset);
+
+  if (ok && ((memcmp(header.Magic, expected.Magic, sizeof(header.Magic)) != 0) || (header.Version != expected.Version) ||
+             (header.nRank != static_cast<uint64_t>(SU2_MPI::GetSize())) || (header.nBuffer != buffers.size()))) {
+    close(fd);
+    return filename + " is not a checkpoint file of this version and number of ranks.";
+  }
+
+  /*--- The checkpoint was allocated with the current settings, they must be the ones the file was written with. ---*/
+  for (auto* buffer : buffers) {
+    if (!ok) break;
+    uint64_t Record[5];
+    ok = ReadAt(fd, Record, sizeof(Record), offset);
+    if (ok && ((Record[0] != buffer->nPoint) || (Record[1] != buffer->nVar) || (Record[2] != buffer->IsSingle) ||
+               (Record[3] != buffer->IsCompressed) || (Record[4] != buffer->Blocks.size()))) {
+      close(fd);
+      return filename + " was written with other checkpoint settings or another mesh partition.";
+    }
+
+    uint64_t checksum = ChecksumSeed;
+    bool valid = true;
+    if (buffer->IsCompressed) {
+      const unsigned long BlockSize = CPreciceCheckpointBuffer::BlockSize;
+      for (auto iBlock = 0ul; ok && valid && (iBlock < buffer->Blocks.size()); iBlock++) {
+        auto& block = buffer->Blocks[iBlock];
+        const unsigned long nPoint = min(BlockSize, buffer->nPoint - iBlock*BlockSize);
+        uint64_t nByte = 0;
+        ok = ReadAt(fd, &nByte, sizeof(nByte), offset);
+        /*--- The size is bounded before anything is allocated from it. ---*/
+        valid = !ok || (nByte <= MaxCompressedSize(nPoint*buffer->nVar));
+        if (!ok || !valid) break;
+        block.resize(nByte);
+        ok = ReadAt(fd, block.data(), nByte, offset);
+        UpdateChecksum(checksum, &nByte, sizeof(nByte));
+        UpdateChecksum(checksum, block.data(), nByte);
+      }
+    }
+    else if (buffer->IsSingle) {
+      const size_t nByte = buffer->nPoint*buffer->nVar*sizeof(float);
+      ok = ReadAt(fd, buffer->Single.data(), nByte, offset);
+      UpdateChecksum(checksum, buffer->Single.data(), nByte);
+    }
+    else {
+      const size_t nByte = buffer->nPoint*buffer->nVar*sizeof(su2double);
+      ok = ReadAt(fd, buffer->Double.data(), nByte, offset);
+      UpdateChecksum(checksum, buffer->Double.data(), nByte);
+    }
+
+    uint64_t stored = 0;
+    ok = ok && valid && ReadAt(fd, &stored, sizeof(stored), offset);
+    if (!valid || (ok && (stored != checksum))) {
+      close(fd);
+      return filename + " is damaged, a checkpoint buffer does not match its checksum.";
+    }
+
+    /*--- The blocks are decoded on every reload, so each is checked once here. ---*/
+    if (ok && buffer->IsCompressed) {
+      const unsigned long BlockSize = CPreciceCheckpointBuffer::BlockSize;
+      vector<uint8_t> scratch;
+      vector<su2double> values(BlockSize*buffer->nVar);
+      for (auto iBlock = 0ul; iBlock < buffer->Blocks.size(); iBlock++) {
+        const unsigned long nPoint = min(BlockSize, buffer->nPoint - iBlock*BlockSize);
+        if (!DecompressBlock(buffer->Blocks[iBlock], nPoint, buffer->nVar, scratch, values.data())) {
+          close(fd);
+          return filename + " is damaged, a compressed checkpoint block cannot be decoded.";
+        }
+      }
+    }
+  }
+
+  close(fd);
+  if (!ok) return "Could not read " + filename + ", the file is incomplete.";
+
+  checkpoint.TimeWindow = header.TimeWindow;
+  checkpoint.TimeIter = header.TimeIter;
+  checkpoint.Solution_time_n_IsSolution = header.IsSolution & 1;
+  checkpoint.TURB_Solution_time_n_IsSolution = header.IsSolution & 2;
+  checkpoint.MESH_Solution_time_n_IsSolution = header.IsSolution & 4;
+  checkpoint.Volume_n_IsVolume = header.IsSolution & 8;
+  for (auto iScalar = 0u; iScalar < checkpoint.SCALAR.size(); iScalar++)
+    checkpoint.SCALAR[iScalar].Solution_time_n_IsSolution = (header.IsSolution >> (4 + iScalar)) & 1;
+  return "";
+}
+
+// preCICE:
+void CDriver::WaitCheckpointFile() {
+  if (!preCICE_CheckpointFile_Pending.valid()) return;
+  const string error = preCICE_CheckpointFile_Pending.get();
+  if (!error.empty()) SU2_MPI::Error(error, CURRENT_FUNCTION);
+}
+
+// preCICE:
+void CDriver::SetCheckpointFile(string filename) {
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Error("Checkpoint files are not available in AD builds.", CURRENT_FUNCTION);
+#endif
+  WaitSaveOldState();
+  WaitCheckpointFile();
+  preCICE_CheckpointFile = (filename.empty()) ? "" : filename + "_" + to_string(SU2_MPI::GetRank()) + ".bin";
+}
+
+// preCICE:
+void CDriver::RestoreCheckpointFile() {
+  WaitSaveOldState();
+
+  if (preCICE_CheckpointFile.empty())
+    SU2_MPI::Error("SetCheckpointFile must be called before RestoreCheckpointFile.", CURRENT_FUNCTION);
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The checkpoint file must be restored before the first call to SaveOldState.", CURRENT_FUNCTION);
+
+  /*--- Allocate the ring with the current settings by saving the initial state, without writing it
+   *    over the file that is restored. ---*/
+  const string filename = preCICE_CheckpointFile;
+  preCICE_CheckpointFile.clear();
+  StoreOldState(config_container[ZONE_0]->GetTimeIter());
+  preCICE_CheckpointFile = filename;
+
+  const string error = ReadCheckpointFile(preCICE_Checkpoints[preCICE_Checkpoint_Last], filename);
+  if (!error.empty()) SU2_MPI::Error(error, CURRENT_FUNCTION);
+
+  ReloadOldState();
+}
+
+// preCICE:
+void CDriver::SaveCheckpointBuffer(unsigned long size, const su2double* src, CPreciceCheckpointBuffer& buffer) {
+
+  if (buffer.IsCompressed) {
+    const unsigned long BlockSize = CPreciceCheckpointBuffer::BlockSize;
+    vector<uint8_t>& scratch = preCICE_CheckpointScratch[omp_get_thread_num()];
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < buffer.Blocks.size(); iBlock++) {
+      const unsigned long iPoint = iBlock*BlockSize;
+      const unsigned long nPoint = min(BlockSize, buffer.nPoint - iPoint);
+      CompressBlock(src + iPoint*buffer.nVar, nPoint, buffer.nVar, scratch, buffer.Blocks[iBlock]);
+    }
+    END_SU2_OMP_FOR
+    return;
+  }
+
+  if (!buffer.IsSingle) {
+    parallelCopy(size, src, buffer.Double.data());
+    return;
+  }
+
+  float* dst = buffer.Single.data();
+  passivedouble myError = 0.0;
+
+  SU2_OMP_FOR_STAT(2048)
+  for (unsigned long i = 0; i < size; i++) {
+    dst[i] = SU2_TYPE::GetValue(src[i]);
+    myError = max(myError, fabs(SU2_TYPE::GetValue(src[i]) - dst[i]));
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  buffer.MaxError = max(buffer.MaxError, myError);
+  END_SU2_OMP_CRITICAL
+}
+
+// preCICE:
+void CDriver::LoadCheckpointBuffer(unsigned long size, const CPreciceCheckpointBuffer& buffer, su2double* dst) {
+
+  /*--- Compressed blocks are decoded straight into the destination, without a full size temporary. They were
+   *    compressed by this run or checked by ReadCheckpointFile, so they always decode. ---*/
+  if (buffer.IsCompressed) {
+    const unsigned long BlockSize = CPreciceCheckpointBuffer::BlockSize;
+    vector<uint8_t>& scratch = preCICE_CheckpointScratch[omp_get_thread_num()];
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < buffer.Blocks.size(); iBlock++) {
+      const unsigned long iPoint = iBlock*BlockSize;
+      const unsigned long nPoint = min(BlockSize, buffer.nPoint - iPoint);
+      DecompressBlock(buffer.Blocks[iBlock], nPoint, buffer.nVar, scratch, dst + iPoint*buffer.nVar);
+    }
+    END_SU2_OMP_FOR
+  }
+  else if (buffer.IsSingle) parallelCopy(size, buffer.Single.data(), dst);
+  else parallelCopy(size, buffer.Double.data(), dst);
+}
+
+// preCICE:
+void CDriver::ResizeCheckpointScratch() {
+  const size_t nThread = omp_get_max_threads();
+  if (preCICE_CheckpointScratch.size() < nThread) preCICE_CheckpointScratch.resize(nThread);
+}
+
+// preCICE:
+CDriver::CPreciceCheckpointBuffer CDriver::CPreciceCheckpoint::* CDriver::GetCheckpointField(const string& field) {
+
+  static const map<string, CPreciceCheckpointBuffer CPreciceCheckpoint::*> Fields = {
+    {"SOLUTION", &CPreciceCheckpoint::Solution},
+    {"SOLUTION_TIME_N", &CPreciceCheckpoint::Solution_time_n},
+    {"SOLUTION_TIME_N1", &CPreciceCheckpoint::Solution_time_n1},
+    {"TURB_SOLUTION", &CPreciceCheckpoint::TURB_Solution},
+    {"TURB_SOLUTION_TIME_N", &CPreciceCheckpoint::TURB_Solution_time_n},
+    {"TURB_SOLUTION_TIME_N1", &CPreciceCheckpoint::TURB_Solution_time_n1},
+    {"MESH_SOLUTION", &CPreciceCheckpoint::MESH_Solution},
+    {"MESH_SOLUTION_TIME_N", &CPreciceCheckpoint::MESH_Solution_time_n},
+    {"MESH_SOLUTION_TIME_N1", &CPreciceCheckpoint::MESH_Solution_time_n1},
+    {"COORD", &CPreciceCheckpoint::Coord},
+    {"GRID_VEL", &CPreciceCheckpoint::GridVel},
+    {"VOLUME", &CPreciceCheckpoint::Volume},
+    {"VOLUME_N", &CPreciceCheckpoint::Volume_n},
+    {"VOLUME_NM1", &CPreciceCheckpoint::Volume_nM1}};
+
+  const auto it = Fields.find(field);
+  if (it == Fields.end()) SU2_MPI::Error("Unknown checkpoint field " + field + ".", CURRENT_FUNCTION);
+  return it->second;
+}
+
+// preCICE:
+void CDriver::SaveSolutionLevels(CVariable* nodes, unsigned short nVar, bool shift, bool aliased,
+                                 CPreciceCheckpointBuffer& Solution, CPreciceCheckpointBuffer& Solution_time_n,
+                                 CPreciceCheckpointBuffer& Solution_time_n1, bool& time_n_IsSolution) {
+
+  const unsigned long size = Solution.nPoint*nVar;
+
+  const su2double* sol = nodes->GetSolution().data();
+  const su2double* sol_n = nodes->GetSolution_time_n().data();
+  const su2double* sol_n1 = nodes->GetSolution_time_n1().data();
+
+  /*--- The dual-time update moved the level n of the previous save to level n-1, take over that buffer
+   *    if it is stored like the level n-1 (swapping fields of different storage would mix them up). ---*/
+  auto& previous_n = time_n_IsSolution ? Solution : Solution_time_n;
+  shift = shift && previous_n.SameStorage(Solution_time_n1);
+  if (shift) swap(Solution_time_n1, previous_n);
+
+  /*--- Right after the dual-time update the level n is a copy of the solution, then it is only stored once. ---*/
+  time_n_IsSolution = aliased;
+
+  Solution.MaxError = 0.0;
+  if (!time_n_IsSolution) Solution_time_n.MaxError = 0.0;
+  if (!shift) Solution_time_n1.MaxError = 0.0;
+
+  /*--- The solution containers are row-major with the domain points first, so every saved
+   *    level is a single contiguous block, copied by all threads. ---*/
+  SU2_OMP_PARALLEL {
+    SaveCheckpointBuffer(size, sol, Solution);
+    if (!time_n_IsSolution) SaveCheckpointBuffer(size, sol_n, Solution_time_n);
+    if (!shift) SaveCheckpointBuffer(size, sol_n1, Solution_time_n1);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- An aliased level n has the round-trip error of the solution. ---*/
+  if (time_n_IsSolution) Solution_time_n.MaxError = Solution.MaxError;
+}
+
+// preCICE:
+void CDriver::SaveOldState(unsigned long TimeIter) {
+  WaitSaveOldState();
+  /*--- The checkpoint file of the previous save may still be written from the ring. ---*/
+  WaitCheckpointFile();
+  KeepSwappedOldState();
+  StoreOldState(TimeIter);
+}
+
+// preCICE:
+void CDriver::StartSaveOldState(unsigned long TimeIter) {
+  WaitSaveOldState();
+  /*--- Blocking waits and errors stay on the calling thread, the helper only copies. ---*/
+  WaitCheckpointFile();
+  KeepSwappedOldState();
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  /*--- Copying the AD types records on the tape of the calling thread, save synchronously. ---*/
+  StoreOldState(TimeIter);
+#else
+  /*--- The helper makes no MPI calls, its errors are raised by WaitSaveOldState. It is not an OpenMP thread,
+   *    so it gets the number of threads of the caller, its parallel regions run while the caller waits
+   *    for the coupling data. ---*/
+  const int nThread = omp_get_max_threads();
+  preCICE_SaveOldState_Pending = async(launch::async, [this, nThread, TimeIter]() -> string {
+#ifdef HAVE_OMP
+    omp_set_num_threads(nThread);
+#endif
+    try {
+      StoreOldState(TimeIter);
+    } catch (const exception& e) {
+      return string("The checkpoint could not be saved: ") + e.what();
+    }
+    return "";
+  });
+#endif
+}
+
+// preCICE:
+void CDriver::KeepSwappedOldState() {
+  /*--- The new state goes into the next slot of the ring. With a single slot that is the swapped out
+   *    checkpoint, which is overwritten anyway, otherwise the swapped out one must be kept for later reloads. ---*/
+  if (preCICE_CopyOnWrite_Pending && (preCICE_Checkpoints.size() > 1)) CopyOnWriteOldState();
+}
+
+// preCICE:
+void CDriver::WaitSaveOldState() const {
+  if (!preCICE_SaveOldState_Pending.valid()) return;
+  const string error = preCICE_SaveOldState_Pending.get();
+  if (!error.empty()) SU2_MPI::Error(error, CURRENT_FUNCTION);
+}
+
+// preCICE:
+void CDriver::StoreOldState(unsigned long TimeIter) {
+
+  ResizeCheckpointScratch();
+
+  // Get the number of solution variables, points (owned by this rank), and dimension
   const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   const unsigned long nPoint_Local = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain();
   const unsigned short nDim = geometry_container[ZONE_0][INST_0][MESH_0]->GetnDim();
-  
+
   // Get if RANS
   const bool rans = config_container[ZONE_0]->GetKind_Turb_Model() != TURB_MODEL::NONE;
   const unsigned short TURB_nVar = (rans) ? solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar() : 0;
@@ -589,67 +1426,500 @@ void CDriver::SaveOldState() {
   // Get if this is dynamic grid (for unsteady FSI problems)
   const bool dynamic_grid = config_container[ZONE_0]->GetDynamic_Grid();
   const unsigned short MESH_nVar = (dynamic_grid) ? solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetnVar() : 0;
-  
-  // Instantiate all required member variables if they aren't already
-  if (preCICE_Solution.empty()) preCICE_Solution.resize(nPoint_Local, nVar) = su2double(0.0);
-  if (preCICE_Solution_time_n.empty()) preCICE_Solution_time_n.resize(nPoint_Local,nVar) = su2double(0.0);
-  if (preCICE_Solution_time_n1.empty()) preCICE_Solution_time_n1.resize(nPoint_Local,nVar) = su2double(0.0);
+
+  // Get the number of coarse multigrid levels
+  const unsigned short nMGLevels = config_container[ZONE_0]->GetnMGLevels();
+
+  /*--- The minimal mode derives the coordinates, grid velocity and volume on reload, they are only stored to verify that. ---*/
+  const bool store_geometry = !preCICE_CheckpointMinimal || preCICE_CheckpointVerify;
+
+  /*--- All checkpoints are allocated at the first save, later saves only copy. ---*/
+  if (preCICE_Checkpoints.empty()) {
+    auto single = [&](const string& field) {
+      const auto it = preCICE_CheckpointSingle.find(field);
+      return (it != preCICE_CheckpointSingle.end()) && it->second;
+    };
+    auto compressed = [&](const string& field) {
+      const auto it = preCICE_CheckpointCompressed.find(field);
+      return (it != preCICE_CheckpointCompressed.end()) && it->second;
+    };
+
+    /*--- The halos are consistent when saving, storing them avoids the comms on reload. A solution
+     *    swapped into the solver needs them as well. ---*/
+    preCICE_Checkpoint_WithHalo = preCICE_CheckpointHalo || preCICE_CheckpointSwap;
+    const unsigned long nPoint_Saved = (preCICE_Checkpoint_WithHalo) ? geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint() : nPoint_Local;
+
+    /*--- All other active solvers (e.g. species, transition) are saved through the same path. ---*/
+    preCICE_ScalarSolvers.clear();
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      if ((iSol == FLOW_SOL) || (iSol == TURB_SOL) || (iSol == MESH_SOL)) continue;
+      if (solver_container[ZONE_0][INST_0][MESH_0][iSol] != nullptr) preCICE_ScalarSolvers.push_back(iSol);
+    }
+
+    preCICE_Checkpoints.resize(preCICE_nCheckpoint);
+    for (auto& checkpoint : preCICE_Checkpoints) {
+      checkpoint.Solution.resize(nPoint_Saved, nVar, single("SOLUTION"), compressed("SOLUTION"));
+      checkpoint.Solution_time_n.resize(nPoint_Saved, nVar, single("SOLUTION_TIME_N"), compressed("SOLUTION_TIME_N"));
+      checkpoint.Solution_time_n1.resize(nPoint_Saved, nVar, single("SOLUTION_TIME_N1"), compressed("SOLUTION_TIME_N1"));
+      if (rans) {
+        checkpoint.TURB_Solution.resize(nPoint_Saved, TURB_nVar, single("TURB_SOLUTION"), compressed("TURB_SOLUTION"));
+        checkpoint.TURB_Solution_time_n.resize(nPoint_Saved, TURB_nVar, single("TURB_SOLUTION_TIME_N"), compressed("TURB_SOLUTION_TIME_N"));
+        checkpoint.TURB_Solution_time_n1.resize(nPoint_Saved, TURB_nVar, single("TURB_SOLUTION_TIME_N1"), compressed("TURB_SOLUTION_TIME_N1"));
+      }
+      checkpoint.SCALAR.resize(preCICE_ScalarSolvers.size());
+      for (auto iScalar = 0u; iScalar < preCICE_ScalarSolvers.size(); iScalar++) {
+        const unsigned short SCALAR_nVar = solver_container[ZONE_0][INST_0][MESH_0][preCICE_ScalarSolvers[iScalar]]->GetnVar();
+        checkpoint.SCALAR[iScalar].Solution.resize(nPoint_Saved, SCALAR_nVar, false);
+        checkpoint.SCALAR[iScalar].Solution_time_n.resize(nPoint_Saved, SCALAR_nVar, false);
+        checkpoint.SCALAR[iScalar].Solution_time_n1.resize(nPoint_Saved, SCALAR_nVar, false);
+      }
+      if (dynamic_grid) {
+        checkpoint.MESH_Solution.resize(nPoint_Saved, MESH_nVar, single("MESH_SOLUTION"), compressed("MESH_SOLUTION"));
+        checkpoint.MESH_Solution_time_n.resize(nPoint_Saved, MESH_nVar, single("MESH_SOLUTION_TIME_N"), compressed("MESH_SOLUTION_TIME_N"));
+        checkpoint.MESH_Solution_time_n1.resize(nPoint_Saved, MESH_nVar, single("MESH_SOLUTION_TIME_N1"), compressed("MESH_SOLUTION_TIME_N1"));
+        if (store_geometry) {
+          checkpoint.Coord.resize(nPoint_Local, nDim, single("COORD"));
+          checkpoint.GridVel.resize(nPoint_Local, nDim, single("GRID_VEL"));
+          checkpoint.Volume.resize(nPoint_Local, 1, single("VOLUME"));
+        }
+        checkpoint.Volume_n.resize(nPoint_Local, 1, single("VOLUME_N"));
+        checkpoint.Volume_nM1.resize(nPoint_Local, 1, single("VOLUME_NM1"));
+      }
+      if (dynamic_grid && preCICE_CheckpointMetrics) {
+        checkpoint.Metrics_Coord.resize(nMGLevels+1);
+        checkpoint.Metrics_Volume.resize(nMGLevels+1);
+        checkpoint.Metrics_Edge_Normal.resize(nMGLevels+1);
+        checkpoint.Metrics_Vertex_Normal.resize(nMGLevels+1);
+        for (auto iMesh = 0u; iMesh <= nMGLevels; iMesh++) {
+          const CGeometry* geometry = geometry_container[ZONE_0][INST_0][iMesh];
+          unsigned long nVertex = 0;
+          for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
+            nVertex += geometry->GetnVertex(iMarker);
+
+          if (iMesh) checkpoint.Metrics_Coord[iMesh].resize(geometry->GetnPoint(), nDim, false);
+          else checkpoint.Metrics_MaxLength.resize(geometry->GetnPoint(), 1, false);
+          checkpoint.Metrics_Volume[iMesh].resize(geometry->GetnPoint(), 1, false);
+          checkpoint.Metrics_Edge_Normal[iMesh].resize(geometry->GetnEdge(), nDim, false);
+          checkpoint.Metrics_Vertex_Normal[iMesh].resize(nVertex, nDim, false);
+        }
+      }
+      if (preCICE_CheckpointMultigrid) {
+        checkpoint.MG_Solution.resize(nMGLevels);
+        checkpoint.MG_Solution_time_n.resize(nMGLevels);
+        checkpoint.MG_Solution_time_n1.resize(nMGLevels);
+        checkpoint.MG_TURB_Solution.resize(nMGLevels);
+        checkpoint.MG_TURB_muT.resize(nMGLevels);
+        for (auto iMesh = 1u; iMesh <= nMGLevels; iMesh++) {
+          const unsigned long nPoint_Coarse = geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint();
+          checkpoint.MG_Solution[iMesh-1].resize(nPoint_Coarse, nVar, false);
+          checkpoint.MG_Solution_time_n[iMesh-1].resize(nPoint_Coarse, nVar, false);
+          checkpoint.MG_Solution_time_n1[iMesh-1].resize(nPoint_Coarse, nVar, false);
+          if (rans) {
+            checkpoint.MG_TURB_Solution[iMesh-1].resize(nPoint_Coarse, TURB_nVar, false);
+            checkpoint.MG_TURB_muT[iMesh-1].resize(nPoint_Coarse, 1, false);
+          }
+        }
+      }
+    }
+  }
+
+  const unsigned short nCheckpoint = preCICE_Checkpoints.size();
+  const bool saved = preCICE_nCheckpoint_Saved > 0;
+  const CPreciceCheckpoint& previous = preCICE_Checkpoints[preCICE_Checkpoint_Last];
+
+  /*--- The states are tagged with the time iteration that runs next. If exactly one time iteration was
+   *    completed since the previous save, the dual-time update (n -> n-1, solution -> n) ran last: the
+   *    current level n equals the solution, and the current level n-1 is the saved level n. This is known
+   *    from the time iterations, without comparing the data.
+   *    The buffer of the level n-1 can only be taken over if the previous checkpoint is overwritten, i.e.
+   *    with a single checkpoint. A swapped out checkpoint no longer holds the saved level n. ---*/
+  const bool dual_time = (config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                         (config_container[ZONE_0]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  const bool aliased = dual_time && saved && !preCICE_CopyOnWrite_Pending && (TimeIter == previous.TimeIter + 1);
+  const bool shift = aliased && (nCheckpoint == 1);
+
+  /*--- Advance the ring, the oldest checkpoint is overwritten once all are in use. ---*/
+  const unsigned long TimeWindow = (saved) ? previous.TimeWindow + 1 : 0;
+  if (saved) preCICE_Checkpoint_Last = (preCICE_Checkpoint_Last + 1) % nCheckpoint;
+  preCICE_nCheckpoint_Saved = min<unsigned short>(preCICE_nCheckpoint_Saved + 1, nCheckpoint);
+  preCICE_CopyOnWrite_Pending = false;
+
+  CPreciceCheckpoint& checkpoint = preCICE_Checkpoints[preCICE_Checkpoint_Last];
+  checkpoint.TimeWindow = TimeWindow;
+  checkpoint.TimeIter = TimeIter;
+
+  CVariable *FLOW_nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+  SaveSolutionLevels(FLOW_nodes, nVar, shift, aliased, checkpoint.Solution, checkpoint.Solution_time_n,
+                     checkpoint.Solution_time_n1, checkpoint.Solution_time_n_IsSolution);
 
   if (rans) {
-    if (preCICE_TURB_Solution.empty()) preCICE_TURB_Solution.resize(nPoint_Local,TURB_nVar) = su2double(0.0);
-    if (preCICE_TURB_Solution_time_n.empty()) preCICE_TURB_Solution_time_n.resize(nPoint_Local,TURB_nVar) = su2double(0.0);
-    if (preCICE_TURB_Solution_time_n1.empty()) preCICE_TURB_Solution_time_n1.resize(nPoint_Local,TURB_nVar) = su2double(0.0);
+    CVariable *TURB_nodes = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes();
+    SaveSolutionLevels(TURB_nodes, TURB_nVar, shift, aliased, checkpoint.TURB_Solution,
+                       checkpoint.TURB_Solution_time_n, checkpoint.TURB_Solution_time_n1,
+                       checkpoint.TURB_Solution_time_n_IsSolution);
+  }
+
+  for (auto iScalar = 0u; iScalar < preCICE_ScalarSolvers.size(); iScalar++) {
+    CSolver *SCALAR_solver = solver_container[ZONE_0][INST_0][MESH_0][preCICE_ScalarSolvers[iScalar]];
+    auto& levels = checkpoint.SCALAR[iScalar];
+    SaveSolutionLevels(SCALAR_solver->GetNodes(), SCALAR_solver->GetnVar(), shift, aliased, levels.Solution,
+                       levels.Solution_time_n, levels.Solution_time_n1, levels.Solution_time_n_IsSolution);
+  }
+
+  if (dynamic_grid) {
+    CVariable *MESH_nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+    SaveSolutionLevels(MESH_nodes, MESH_nVar, shift, aliased, checkpoint.MESH_Solution,
+                       checkpoint.MESH_Solution_time_n, checkpoint.MESH_Solution_time_n1,
+                       checkpoint.MESH_Solution_time_n_IsSolution);
+
+    CPoint *nodes = geometry_container[ZONE_0][INST_0][MESH_0]->nodes;
+
+    /*--- Same bookkeeping for the volumes, which are shifted together with the solution. ---*/
+    auto& previous_Volume_n = checkpoint.Volume_n_IsVolume ? checkpoint.Volume : checkpoint.Volume_n;
+    const bool shift_Volume = shift && previous_Volume_n.SameStorage(checkpoint.Volume_nM1);
+    if (shift_Volume) swap(checkpoint.Volume_nM1, previous_Volume_n);
+
+    checkpoint.Volume_n_IsVolume = store_geometry && aliased;
+
+    CPreciceCheckpointBuffer* Saved[] = {&checkpoint.Coord, &checkpoint.GridVel, &checkpoint.Volume,
+                                         &checkpoint.Volume_n, &checkpoint.Volume_nM1};
+    const bool Stored[] = {store_geometry, store_geometry, store_geometry, !checkpoint.Volume_n_IsVolume, !shift_Volume};
+    for (auto iField = 0u; iField < 5; iField++)
+      if (Stored[iField]) Saved[iField]->MaxError = 0.0;
+
+    SU2_OMP_PARALLEL {
+      passivedouble myError[5] = {0.0};
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Local, omp_get_max_threads()))
+      for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++) {
+        if (store_geometry) {
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            myError[0] = max(myError[0], checkpoint.Coord.Set(iPoint_Local, iDim, nodes->GetCoord(iPoint_Local, iDim)));
+            myError[1] = max(myError[1], checkpoint.GridVel.Set(iPoint_Local, iDim, nodes->GetGridVel(iPoint_Local)[iDim]));
+          }
+          myError[2] = max(myError[2], checkpoint.Volume.Set(iPoint_Local, 0, nodes->GetVolume(iPoint_Local)));
+        }
+        if (Stored[3]) myError[3] = max(myError[3], checkpoint.Volume_n.Set(iPoint_Local, 0, nodes->GetVolume_n(iPoint_Local)));
+        if (Stored[4]) myError[4] = max(myError[4], checkpoint.Volume_nM1.Set(iPoint_Local, 0, nodes->GetVolume_nM1(iPoint_Local)));
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_CRITICAL
+      for (auto iField = 0u; iField < 5; iField++)
+        if (Stored[iField]) Saved[iField]->MaxError = max(Saved[iField]->MaxError, myError[iField]);
+      END_SU2_OMP_CRITICAL
+    }
+    END_SU2_OMP_PARALLEL
+
+    if (checkpoint.Volume_n_IsVolume) checkpoint.Volume_n.MaxError = checkpoint.Volume.MaxError;
+  }
+
+  if (dynamic_grid && preCICE_CheckpointMetrics) SaveGeometryMetrics(checkpoint);
+
+  /*--- The coarse levels are saved with their halos and eddy viscosity, so that reloading them
+   *    replaces the restriction, comms and preprocessing in FinalizeFLOW_SOL and FinalizeTURB_SOL. ---*/
+  if (preCICE_CheckpointMultigrid) {
+    for (auto iMesh = 1u; iMesh <= nMGLevels; iMesh++) {
+      const unsigned long nPoint_Coarse = geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint();
+      CVariable *FLOW_coarse = solver_container[ZONE_0][INST_0][iMesh][FLOW_SOL]->GetNodes();
+      CVariable *TURB_coarse = (rans) ? solver_container[ZONE_0][INST_0][iMesh][TURB_SOL]->GetNodes() : nullptr;
+
+      SU2_OMP_PARALLEL {
+        SaveCheckpointBuffer(nPoint_Coarse*nVar, FLOW_coarse->GetSolution().data(), checkpoint.MG_Solution[iMesh-1]);
+        SaveCheckpointBuffer(nPoint_Coarse*nVar, FLOW_coarse->GetSolution_time_n().data(), checkpoint.MG_Solution_time_n[iMesh-1]);
+        SaveCheckpointBuffer(nPoint_Coarse*nVar, FLOW_coarse->GetSolution_time_n1().data(), checkpoint.MG_Solution_time_n1[iMesh-1]);
+
+        if (rans) {
+          SaveCheckpointBuffer(nPoint_Coarse*TURB_nVar, TURB_coarse->GetSolution().data(), checkpoint.MG_TURB_Solution[iMesh-1]);
+
+          SU2_OMP_FOR_STAT(roundUpDiv(nPoint_Coarse, omp_get_max_threads()))
+          for (unsigned long iPoint = 0; iPoint < nPoint_Coarse; iPoint++)
+            checkpoint.MG_TURB_muT[iMesh-1].Set(iPoint, 0, TURB_coarse->GetmuT(iPoint));
+          END_SU2_OMP_FOR
+        }
+      }
+      END_SU2_OMP_PARALLEL
+    }
+  }
+
+  /*--- Write the new checkpoint to disk in the background, it is not modified until the next save or reload. ---*/
+  if (!preCICE_CheckpointFile.empty())
+    preCICE_CheckpointFile_Pending = async(launch::async, WriteCheckpointFile, ref(checkpoint), preCICE_CheckpointFile);
+}
+
+// preCICE:
+void CDriver::SaveGeometryMetrics(CPreciceCheckpoint& checkpoint) {
+
+  const unsigned short nDim = geometry_container[ZONE_0][INST_0][MESH_0]->GetnDim();
+
+  for (auto iMesh = 0u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    CGeometry* geometry = geometry_container[ZONE_0][INST_0][iMesh];
+    const unsigned long nPoint = geometry->GetnPoint();
+    const unsigned long nEdge = geometry->GetnEdge();
+
+    SU2_OMP_PARALLEL {
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        checkpoint.Metrics_Volume[iMesh].Set(iPoint, 0, geometry->nodes->GetVolume(iPoint));
+        if (iMesh) {
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            checkpoint.Metrics_Coord[iMesh].Set(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+        }
+        else checkpoint.Metrics_MaxLength.Set(iPoint, 0, geometry->nodes->GetMaxLength(iPoint));
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_FOR_STAT(roundUpDiv(nEdge, omp_get_max_threads()))
+      for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+        const su2double* Normal = geometry->edges->GetNormal(iEdge);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          checkpoint.Metrics_Edge_Normal[iMesh].Set(iEdge, iDim, Normal[iDim]);
+      }
+      END_SU2_OMP_FOR
+
+      /*--- The normals of all markers are stored one after the other. ---*/
+      unsigned long Offset = 0;
+      for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+        const unsigned long nVertex = geometry->GetnVertex(iMarker);
+        if (nVertex == 0) continue;
+
+        SU2_OMP_FOR_STAT(roundUpDiv(nVertex, omp_get_max_threads()))
+        for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+          const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            checkpoint.Metrics_Vertex_Normal[iMesh].Set(Offset + iVertex, iDim, Normal[iDim]);
+        }
+        END_SU2_OMP_FOR
+        Offset += nVertex;
+      }
+    }
+    END_SU2_OMP_PARALLEL
+  }
+}
+
+// preCICE:
+void CDriver::LoadGeometryMetrics(const CPreciceCheckpoint& checkpoint) {
+
+  const unsigned short nDim = geometry_container[ZONE_0][INST_0][MESH_0]->GetnDim();
+
+  for (auto iMesh = 0u; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    CGeometry* geometry = geometry_container[ZONE_0][INST_0][iMesh];
+    const unsigned long nPoint = geometry->GetnPoint();
+    const unsigned long nEdge = geometry->GetnEdge();
+
+    SU2_OMP_PARALLEL {
+      SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        geometry->nodes->SetVolume(iPoint, checkpoint.Metrics_Volume[iMesh].Get(iPoint, 0));
+        if (iMesh) {
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            geometry->nodes->SetCoord(iPoint, iDim, checkpoint.Metrics_Coord[iMesh].Get(iPoint, iDim));
+        }
+        else geometry->nodes->SetMaxLength(iPoint, checkpoint.Metrics_MaxLength.Get(iPoint, 0));
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_FOR_STAT(roundUpDiv(nEdge, omp_get_max_threads()))
+      for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+        su2double Normal[MAXNDIM] = {0.0};
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Normal[iDim] = checkpoint.Metrics_Edge_Normal[iMesh].Get(iEdge, iDim);
+        geometry->edges->SetNormal(iEdge, Normal);
+      }
+      END_SU2_OMP_FOR
+
+      unsigned long Offset = 0;
+      for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+        const unsigned long nVertex = geometry->GetnVertex(iMarker);
+        if (nVertex == 0) continue;
+
+        SU2_OMP_FOR_STAT(roundUpDiv(nVertex, omp_get_max_threads()))
+        for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+          su2double Normal[MAXNDIM] = {0.0};
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Normal[iDim] = checkpoint.Metrics_Vertex_Normal[iMesh].Get(Offset + iVertex, iDim);
+          geometry->vertex[iMarker][iVertex]->SetNormal(Normal);
+        }
+        END_SU2_OMP_FOR
+        Offset += nVertex;
+      }
+    }
+    END_SU2_OMP_PARALLEL
+  }
+}
+
+// preCICE:
+void CDriver::SetCheckpointGeometryMetrics(bool metrics) {
+  WaitSaveOldState();
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The geometry metrics checkpoint mode must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+  preCICE_CheckpointMetrics = metrics;
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetCheckpointGeometryTime() const { return preCICE_CheckpointGeometryTime; }
+
+// preCICE:
+void CDriver::SetnCheckpoint(unsigned short nCheckpoint) {
+  WaitSaveOldState();
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The number of checkpoints must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+  if (nCheckpoint == 0)
+    SU2_MPI::Error("At least one checkpoint is required.", CURRENT_FUNCTION);
+  preCICE_nCheckpoint = nCheckpoint;
+}
+
+// preCICE:
+unsigned short CDriver::GetnCheckpoint() const {
+  WaitSaveOldState();
+  return preCICE_nCheckpoint_Saved;
+}
+
+// preCICE:
+unsigned long CDriver::GetCheckpointTimeWindow(unsigned short nWindowsBack) const {
+  WaitSaveOldState();
+  if (nWindowsBack >= preCICE_nCheckpoint_Saved)
+    SU2_MPI::Error("The requested checkpoint is not available.", CURRENT_FUNCTION);
+  const unsigned short nCheckpoint = preCICE_Checkpoints.size();
+  return preCICE_Checkpoints[(preCICE_Checkpoint_Last + nCheckpoint - nWindowsBack) % nCheckpoint].TimeWindow;
+}
+
+// preCICE:
+unsigned long CDriver::GetCheckpointTimeIter(unsigned short nWindowsBack) const {
+  WaitSaveOldState();
+  if (nWindowsBack >= preCICE_nCheckpoint_Saved)
+    SU2_MPI::Error("The requested checkpoint is not available.", CURRENT_FUNCTION);
+  const unsigned short nCheckpoint = preCICE_Checkpoints.size();
+  return preCICE_Checkpoints[(preCICE_Checkpoint_Last + nCheckpoint - nWindowsBack) % nCheckpoint].TimeIter;
+}
+
+// preCICE:
+void CDriver::SetCheckpointSinglePrecision(string field, bool single) {
+  WaitSaveOldState();
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  if (single) SU2_MPI::Error("Single precision checkpoints are not available in AD builds.", CURRENT_FUNCTION);
+#endif
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The checkpoint precision must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+
+  GetCheckpointField(field);
+  const auto it = preCICE_CheckpointCompressed.find(field);
+  if (single && (it != preCICE_CheckpointCompressed.end()) && it->second)
+    SU2_MPI::Error("Checkpoint field " + field + " is compressed, it cannot be stored in single precision.", CURRENT_FUNCTION);
+
+  preCICE_CheckpointSingle[field] = single;
+}
+
+// preCICE:
+void CDriver::SetCheckpointCompression(string field, bool compress) {
+  WaitSaveOldState();
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  if (compress) SU2_MPI::Error("Compressed checkpoints are not available in AD builds.", CURRENT_FUNCTION);
+#endif
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The checkpoint compression must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+
+  /*--- The geometry is saved point by point, only the solution levels are contiguous blocks. ---*/
+  const auto member = GetCheckpointField(field);
+  if ((member == &CPreciceCheckpoint::Coord) || (member == &CPreciceCheckpoint::GridVel) ||
+      (member == &CPreciceCheckpoint::Volume) || (member == &CPreciceCheckpoint::Volume_n) ||
+      (member == &CPreciceCheckpoint::Volume_nM1))
+    SU2_MPI::Error("Only the solution fields of the checkpoint can be compressed.", CURRENT_FUNCTION);
+
+  const auto it = preCICE_CheckpointSingle.find(field);
+  if (compress && (it != preCICE_CheckpointSingle.end()) && it->second)
+    SU2_MPI::Error("Checkpoint field " + field + " is stored in single precision, it cannot be compressed.", CURRENT_FUNCTION);
+
+  preCICE_CheckpointCompressed[field] = compress;
+}
+
+// preCICE:
+passivedouble CDriver::GetCheckpointCompressionRatio(string field) const {
+
+  WaitSaveOldState();
+  const auto member = GetCheckpointField(field);
+
+  /*--- Uncompressed and compressed size in bytes. ---*/
+  unsigned long Size[2] = {0, 0};
+  if (preCICE_nCheckpoint_Saved > 0) {
+    const auto& buffer = preCICE_Checkpoints[preCICE_Checkpoint_Last].*member;
+    if (buffer.IsCompressed) {
+      Size[0] = buffer.nPoint*buffer.nVar*sizeof(passivedouble);
+      for (const auto& block : buffer.Blocks) Size[1] += block.size();
+    }
   }
 
-  if (dynamic_grid) {
-    if (preCICE_MESH_Solution.empty()) preCICE_MESH_Solution.resize(nPoint_Local,MESH_nVar) = su2double(0.0);
-    if (preCICE_MESH_Solution_time_n.empty()) preCICE_MESH_Solution_time_n.resize(nPoint_Local,MESH_nVar) = su2double(0.0);
-    if (preCICE_MESH_Solution_time_n1.empty()) preCICE_MESH_Solution_time_n1.resize(nPoint_Local,MESH_nVar) = su2double(0.0);
-  
+  unsigned long Size_Global[2] = {0, 0};
+  SU2_MPI::Allreduce(Size, Size_Global, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  return (Size_Global[1] > 0) ? passivedouble(Size_Global[0]) / Size_Global[1] : 1.0;
+}
+
+// preCICE:
+passivedouble CDriver::GetCheckpointRoundTripError(string field) const {
+
+  WaitSaveOldState();
+  const auto member = GetCheckpointField(field);
+
+  passivedouble MaxError = 0.0;
+  if (preCICE_nCheckpoint_Saved > 0) MaxError = (preCICE_Checkpoints[preCICE_Checkpoint_Last].*member).MaxError;
+
+  passivedouble MaxError_Global = 0.0;
+  SU2_MPI::Allreduce(&MaxError, &MaxError_Global, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  return MaxError_Global;
+}
+
+// preCICE:
+void CDriver::SetCheckpointMinimal(bool minimal, bool verify) {
+  WaitSaveOldState();
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The minimal checkpoint mode must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+  preCICE_CheckpointMinimal = minimal;
+  preCICE_CheckpointVerify = verify;
+}
 
-    if (preCICE_Coord.empty()) preCICE_Coord.resize(nPoint_Local, nDim) = su2double(0.0);
-    if (preCICE_GridVel.empty()) preCICE_GridVel.resize(nPoint_Local,nDim) = su2double(0.0);
-    if (preCICE_Volume.empty()) preCICE_Volume.resize(nPoint_Local) = su2double(0.0);
-    if (preCICE_Volume_n.empty()) preCICE_Volume_n.resize(nPoint_Local) = su2double(0.0);
-    if (preCICE_Volume_nM1.empty()) preCICE_Volume_nM1.resize(nPoint_Local) = su2double(0.0);
-  }
+// preCICE:
+void CDriver::SetCheckpointHalo(bool halo) {
+  WaitSaveOldState();
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The halo checkpoint mode must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+  preCICE_CheckpointHalo = halo;
+}
 
+// preCICE:
+void CDriver::SetCheckpointMultigrid(bool multigrid) {
+  WaitSaveOldState();
+  if (!preCICE_Checkpoints.empty())
+    SU2_MPI::Error("The multigrid checkpoint mode must be set before the first call to SaveOldState.", CURRENT_FUNCTION);
+  preCICE_CheckpointMultigrid = multigrid;
+}
 
-  // Loop through everything and save all necessary variables to reload state
-  for (unsigned long iPoint_Local = 0; iPoint_Local < nPoint_Local; iPoint_Local++) {
-    
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      preCICE_Solution(iPoint_Local, iVar) = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetSolution(iPoint_Local, iVar);
-      preCICE_Solution_time_n(iPoint_Local, iVar) = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetSolution_time_n(iPoint_Local, iVar);
-      preCICE_Solution_time_n1(iPoint_Local, iVar) = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetSolution_time_n1(iPoint_Local, iVar);
-    }
+// preCICE:
+vector<passivedouble> CDriver::GetCheckpointVerificationError() const { return preCICE_CheckpointVerifyError; }
 
-    if (rans) {
-      for (unsigned short TURB_iVar = 0; TURB_iVar < TURB_nVar; TURB_iVar++) {
-        preCICE_TURB_Solution(iPoint_Local, TURB_iVar) = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint_Local, TURB_iVar);
-        preCICE_TURB_Solution_time_n(iPoint_Local, TURB_iVar) = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->GetSolution_time_n(iPoint_Local, TURB_iVar);
-        preCICE_TURB_Solution_time_n1(iPoint_Local, TURB_iVar) = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetNodes()->GetSolution_time_n1(iPoint_Local, TURB_iVar);
-      }
-    }
+// preCICE:
+void CDriver::SetCheckpointSwap(bool swap) {
+  WaitSaveOldState();
+  /*--- Switching off while the checkpoint is swapped out would lose it. ---*/
+  if (!swap) CopyOnWriteOldState();
+  preCICE_CheckpointSwap = swap;
+}
 
-    if (dynamic_grid) {
-      for (unsigned short MESH_iVar = 0; MESH_iVar < MESH_nVar; MESH_iVar++) {
-        preCICE_MESH_Solution(iPoint_Local, MESH_iVar) = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution(iPoint_Local, MESH_iVar);
-        preCICE_MESH_Solution_time_n(iPoint_Local, MESH_iVar) = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution_time_n(iPoint_Local, MESH_iVar);
-        preCICE_MESH_Solution_time_n1(iPoint_Local, MESH_iVar) = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetSolution_time_n1(iPoint_Local, MESH_iVar);
-      }
+// preCICE:
+void CDriver::CopyOnWriteOldState() {
 
+  WaitSaveOldState();
+  WaitCheckpointFile();
+  if (!preCICE_CopyOnWrite_Pending) return;
 
-      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-        preCICE_Coord(iPoint_Local,iDim) = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint_Local,iDim);
-        preCICE_GridVel(iPoint_Local, iDim) = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetGridVel(iPoint_Local)[iDim];
-      }
-      
-      preCICE_Volume(iPoint_Local) = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetVolume(iPoint_Local);
-      preCICE_Volume_n(iPoint_Local) = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetVolume_n(iPoint_Local);
-      preCICE_Volume_nM1(iPoint_Local) = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetVolume_nM1(iPoint_Local);
-    }
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  auto& Solution = preCICE_Checkpoints[preCICE_Checkpoint_Last].Solution;
+  const su2double* sol = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetSolution().data();
+
+  SU2_OMP_PARALLEL {
+    parallelCopy(Solution.nPoint*nVar, sol, Solution.Double.data());
   }
+  END_SU2_OMP_PARALLEL
+
+  preCICE_CopyOnWrite_Pending = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -783,6 +2053,194 @@ passivedouble CDriver::GetThermalConductivity(unsigned short iMarker, unsigned l
 
 }
 
+// preCICE:
+void CDriver::GetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Temperatures) const {
+
+  const unsigned long nVertex = vertices.size();
+  const bool compressible = (config_container[ZONE_0]->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
+  const su2double Temperature_Ref = config_container[ZONE_0]->GetTemperature_Ref();
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+
+  for (unsigned long i = 0; i < nVertex; i++) {
+    const auto iPoint = geometry->vertex[iMarker][vertices[i]]->GetNode();
+    su2double vertexWallTemp = 0.0;
+    if (geometry->nodes->GetDomain(iPoint) && compressible) vertexWallTemp = nodes->GetTemperature(iPoint);
+
+    //preCICE: re-dimensionalize before returning
+    Temperatures[i] = SU2_TYPE::GetValue(vertexWallTemp * Temperature_Ref);
+  }
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices) const {
+
+  vector<passivedouble> Temperatures_passive(vertices.size(), 0.0);
+
+  GetMarkerVertexTemperatures(iMarker, vertices, Temperatures_passive.data());
+
+  return Temperatures_passive;
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerVertexTemperatures(unsigned short iMarker) const {
+
+  return GetMarkerVertexTemperatures(iMarker, GetMarkerPhysicalVertices(iMarker));
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexTemperatures(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Temperatures) {
+
+  const unsigned long nVertex = vertices.size();
+  const su2double invTemperature_Ref = 1.0 / config_container[ZONE_0]->GetTemperature_Ref();
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  // preCICE: non-dimensionalize before setting
+  for (unsigned long i = 0; i < nVertex; i++)
+    geometry->SetCustomBoundaryTemperature(iMarker, vertices[i], Temperatures[i] * invTemperature_Ref);
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexTemperatures(unsigned short iMarker, const vector<passivedouble>& Temperatures, const vector<unsigned long>& vertices) {
+
+  if (Temperatures.size() != vertices.size())
+    SU2_MPI::Error("Size of the temperature buffer does not match the number of vertices.", CURRENT_FUNCTION);
+
+  SetMarkerVertexTemperatures(iMarker, vertices, Temperatures.data());
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexTemperatures(unsigned short iMarker, const vector<passivedouble>& Temperatures) {
+
+  SetMarkerVertexTemperatures(iMarker, Temperatures, GetMarkerPhysicalVertices(iMarker));
+}
+
+// preCICE:
+template<unsigned short NDIM>
+void CDriver::GetMarkerVertexNormalHeatFluxes_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* HeatFluxes) const {
+
+  const unsigned long nVertex = vertices.size();
+  const bool compressible = (config_container[ZONE_0]->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
+
+  /*--- Fluid constants are the same for every vertex, evaluate them once for the marker. ---*/
+  const su2double Prandtl_Lam  = config_container[ZONE_0]->GetPrandtl_Lam();
+  const su2double Gas_Constant = config_container[ZONE_0]->GetGas_ConstantND();
+  const su2double Gamma = config_container[ZONE_0]->GetGamma();
+  const su2double Cp = (Gamma / (Gamma - 1.0)) * Gas_Constant;
+  const su2double factor = -Cp / Prandtl_Lam * config_container[ZONE_0]->GetHeat_Flux_Ref();
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+
+  /*--- The flux is evaluated while gathering the vertex data, without temporaries, vertices that are
+   *    not owned by this rank (and every vertex of an incompressible case) return zero. ---*/
+  for (unsigned long i = 0; i < nVertex; i++) {
+    const auto iPoint = geometry->vertex[iMarker][vertices[i]]->GetNode();
+    if (!(compressible && geometry->nodes->GetDomain(iPoint))) {
+      HeatFluxes[i] = 0.0;
+      continue;
+    }
+
+    const su2double* Normal = geometry->vertex[iMarker][vertices[i]]->GetNormal();
+    su2double dTdn_Area = 0.0;
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+      dTdn_Area += nodes->GetGradient_Primitive(iPoint, 0, iDim) * Normal[iDim];
+
+    const su2double Area = GeometryToolbox::Norm(NDIM, Normal);
+
+    //preCICE: re-dimensionalize before returning
+    HeatFluxes[i] = SU2_TYPE::GetValue(factor * nodes->GetLaminarViscosity(iPoint) * dTdn_Area / Area);
+  }
+
+}
+
+// preCICE:
+void CDriver::GetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* HeatFluxes) const {
+
+  if (nDim == 2) GetMarkerVertexNormalHeatFluxes_impl<2>(iMarker, vertices, HeatFluxes);
+  else GetMarkerVertexNormalHeatFluxes_impl<3>(iMarker, vertices, HeatFluxes);
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices) const {
+
+  vector<passivedouble> HeatFluxes_passive(vertices.size(), 0.0);
+
+  GetMarkerVertexNormalHeatFluxes(iMarker, vertices, HeatFluxes_passive.data());
+
+  return HeatFluxes_passive;
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerVertexNormalHeatFluxes(unsigned short iMarker) const {
+
+  return GetMarkerVertexNormalHeatFluxes(iMarker, GetMarkerPhysicalVertices(iMarker));
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* HeatFluxes) {
+
+  const unsigned long nVertex = vertices.size();
+  const su2double invHeat_Flux_Ref = 1.0 / config_container[ZONE_0]->GetHeat_Flux_Ref();
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  // preCICE: non-dimensionalize before setting
+  for (unsigned long i = 0; i < nVertex; i++)
+    geometry->SetCustomBoundaryHeatFlux(iMarker, vertices[i], HeatFluxes[i] * invHeat_Flux_Ref);
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<passivedouble>& HeatFluxes, const vector<unsigned long>& vertices) {
+
+  if (HeatFluxes.size() != vertices.size())
+    SU2_MPI::Error("Size of the heat flux buffer does not match the number of vertices.", CURRENT_FUNCTION);
+
+  SetMarkerVertexNormalHeatFluxes(iMarker, vertices, HeatFluxes.data());
+}
+
+// preCICE:
+void CDriver::SetMarkerVertexNormalHeatFluxes(unsigned short iMarker, const vector<passivedouble>& HeatFluxes) {
+
+  SetMarkerVertexNormalHeatFluxes(iMarker, HeatFluxes, GetMarkerPhysicalVertices(iMarker));
+}
+
+// preCICE:
+void CDriver::GetMarkerThermalConductivities(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* Conductivities) const {
+
+  const unsigned long nVertex = vertices.size();
+
+  /*--- Fluid constants are the same for every vertex, evaluate them once for the marker. ---*/
+  const su2double Prandtl_Lam  = config_container[ZONE_0]->GetPrandtl_Lam();
+  const su2double Gas_Constant = config_container[ZONE_0]->GetGas_ConstantND();
+  const su2double Gamma = config_container[ZONE_0]->GetGamma();
+  const su2double Cp_Prandtl = (Gamma / (Gamma - 1.0)) * Gas_Constant / Prandtl_Lam;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+
+  for (unsigned long i = 0; i < nVertex; i++) {
+    const auto iPoint = geometry->vertex[iMarker][vertices[i]]->GetNode();
+    Conductivities[i] = SU2_TYPE::GetValue(Cp_Prandtl * nodes->GetLaminarViscosity(iPoint));
+  }
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerThermalConductivities(unsigned short iMarker) const {
+
+  const auto& vertices = GetMarkerPhysicalVertices(iMarker);
+  vector<passivedouble> Conductivities_passive(vertices.size(), 0.0);
+
+  GetMarkerThermalConductivities(iMarker, vertices, Conductivities_passive.data());
+
+  return Conductivities_passive;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /* Functions related to the management of markers                             */
 ////////////////////////////////////////////////////////////////////////////////
@@ -1230,6 +2688,59 @@ void CDriver::SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex,
 
 }
 
+// preCICE:
+template<unsigned short NDIM>
+void CDriver::SetMarkerMeshDisplacements_impl(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Displacements) {
+
+  const unsigned long nVertex = vertices.size();
+  if (nVertex == 0) return;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+
+  /*--- Each vertex of a marker is a different point, the boundary displacements can be set concurrently. ---*/
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(roundUpDiv(nVertex, omp_get_max_threads()))
+    for (unsigned long i = 0; i < nVertex; i++) {
+
+      su2double MeshDispl[NDIM];
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+        MeshDispl[iDim] = Displacements[i*NDIM + iDim];
+
+      const auto iPoint = geometry->vertex[iMarker][vertices[i]]->GetNode();
+      nodes->SetBound_Disp(iPoint, MeshDispl);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+// preCICE:
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const vector<unsigned long>& vertices, const passivedouble* Displacements) {
+
+  if (nDim == 2) SetMarkerMeshDisplacements_impl<2>(iMarker, vertices, Displacements);
+  else SetMarkerMeshDisplacements_impl<3>(iMarker, vertices, Displacements);
+
+}
+
+// preCICE:
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& Displacements, const vector<unsigned long>& vertices) {
+
+  if (Displacements.size() != vertices.size()*nDim)
+    SU2_MPI::Error("Size of the displacement buffer does not match the number of vertices.", CURRENT_FUNCTION);
+
+  SetMarkerMeshDisplacements(iMarker, vertices, Displacements.data());
+
+}
+
+// preCICE:
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& Displacements) {
+
+  SetMarkerMeshDisplacements(iMarker, Displacements, GetMarkerPhysicalVertices(iMarker));
+
+}
+
 void CDriver::CommunicateMeshDisplacement(void) {
 
   solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0],
@@ -1267,3 +2778,235 @@ vector<passivedouble> CDriver::GetFlowLoad(unsigned short iMarker, unsigned long
   return FlowLoad_passive;
 
 }
+
+// preCICE:
+template<unsigned short NDIM>
+void CDriver::GetMarkerFlowLoads_impl(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* FlowLoads) const {
+
+  const unsigned long nVertex = vertices.size();
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  /*--- Tractions only exist on solid walls, everywhere else the load is zero (as in GetFlowLoad). ---*/
+  if (!config_container[ZONE_0]->GetSolid_Wall(iMarker)) {
+    for (unsigned long i = 0; i < nVertex*NDIM; i++) FlowLoads[i] = 0.0;
+    return;
+  }
+
+  /*--- The tractions are protected members of CSolver, the only access is one component per call of
+   *    GetVertexTractions. The specialization only unrolls the components, the loop is not vectorized. ---*/
+  for (unsigned long i = 0; i < nVertex; i++) {
+    const unsigned long iVertex = vertices[i];
+    passivedouble* load = FlowLoads + i*NDIM;
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+      load[iDim] = SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim));
+    }
+  }
+
+}
+
+// preCICE:
+void CDriver::GetMarkerFlowLoads(unsigned short iMarker, const vector<unsigned long>& vertices, passivedouble* FlowLoads) const {
+
+  if (nDim == 2) GetMarkerFlowLoads_impl<2>(iMarker, vertices, FlowLoads);
+  else GetMarkerFlowLoads_impl<3>(iMarker, vertices, FlowLoads);
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerFlowLoads(unsigned short iMarker, const vector<unsigned long>& vertices) const {
+
+  vector<passivedouble> FlowLoads_passive(vertices.size()*nDim, 0.0);
+
+  GetMarkerFlowLoads(iMarker, vertices, FlowLoads_passive.data());
+
+  return FlowLoads_passive;
+
+}
+
+// preCICE:
+vector<passivedouble> CDriver::GetMarkerFlowLoads(unsigned short iMarker) const {
+
+  return GetMarkerFlowLoads(iMarker, GetMarkerPhysicalVertices(iMarker));
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Functions related to the coupling step                                     */
+////////////////////////////////////////////////////////////////////////////////
+
+// preCICE:
+void CDriver::AddCouplingStepMarker(unsigned short iMarker, string readData, string writeData) {
+
+  CPreciceCouplingMarker marker;
+  marker.Marker = iMarker;
+
+  if (readData.empty()) marker.Read = PRECICE_DATA::NONE;
+  else if (readData == "DISPLACEMENT") marker.Read = PRECICE_DATA::DISPLACEMENT;
+  else if (readData == "TEMPERATURE") marker.Read = PRECICE_DATA::TEMPERATURE;
+  else if (readData == "HEAT_FLUX") marker.Read = PRECICE_DATA::HEAT_FLUX;
+  else SU2_MPI::Error("Unknown coupling read data " + readData + ".", CURRENT_FUNCTION);
+
+  if (writeData.empty()) marker.Write = PRECICE_DATA::NONE;
+  else if (writeData == "FORCE") marker.Write = PRECICE_DATA::FORCE;
+  else if (writeData == "TEMPERATURE") marker.Write = PRECICE_DATA::TEMPERATURE;
+  else if (writeData == "HEAT_FLUX") marker.Write = PRECICE_DATA::HEAT_FLUX;
+  else SU2_MPI::Error("Unknown coupling write data " + writeData + ".", CURRENT_FUNCTION);
+
+  marker.nRead = (marker.Read == PRECICE_DATA::NONE) ? 0 : (marker.Read == PRECICE_DATA::DISPLACEMENT) ? nDim : 1;
+  marker.nWrite = (marker.Write == PRECICE_DATA::NONE) ? 0 : (marker.Write == PRECICE_DATA::FORCE) ? nDim : 1;
+
+  preCICE_CouplingMarkers.push_back(marker);
+
+}
+
+// preCICE:
+void CDriver::ClearCouplingStepMarkers() {
+  preCICE_CouplingMarkers.clear();
+}
+
+// preCICE:
+unsigned long CDriver::GetCouplingStepReadSize() const {
+
+  unsigned long size = 0;
+  for (const auto& marker : preCICE_CouplingMarkers)
+    size += GetMarkerPhysicalVertices(marker.Marker).size() * marker.nRead;
+  return size;
+
+}
+
+// preCICE:
+unsigned long CDriver::GetCouplingStepWriteSize() const {
+
+  unsigned long size = 0;
+  for (const auto& marker : preCICE_CouplingMarkers)
+    size += GetMarkerPhysicalVertices(marker.Marker).size() * marker.nWrite;
+  return size;
+
+}
+
+// preCICE:
+bool CDriver::RunCouplingStep(unsigned long TimeIter, passivedouble deltaT, const passivedouble* ReadData, passivedouble* WriteData) {
+
+  /*--- Set the read data, this overlaps with a save started by StartSaveOldState. ---*/
+  bool updateBC = false;
+  for (const auto& marker : preCICE_CouplingMarkers) {
+    const auto& vertices = GetMarkerPhysicalVertices(marker.Marker);
+    switch (marker.Read) {
+      case PRECICE_DATA::DISPLACEMENT:
+        SetMarkerMeshDisplacements(marker.Marker, vertices, ReadData);
+        break;
+      case PRECICE_DATA::TEMPERATURE:
+        SetMarkerVertexTemperatures(marker.Marker, vertices, ReadData);
+        updateBC = true;
+        break;
+      case PRECICE_DATA::HEAT_FLUX:
+        SetMarkerVertexNormalHeatFluxes(marker.Marker, vertices, ReadData);
+        updateBC = true;
+        break;
+      default:
+        break;
+    }
+    ReadData += vertices.size() * marker.nRead;
+  }
+
+  /*--- Only the ranks with a CHT marker have custom boundary values to update. ---*/
+  if (updateBC) BoundaryConditionsUpdate();
+
+  SetUnsteady_TimeStep(deltaT);
+
+  /*--- The solution may only be modified once the saved state is complete. ---*/
+  WaitSaveOldState();
+  CopyOnWriteOldState();
+
+  Preprocess(TimeIter);
+  Run();
+  Postprocess();
+  Update();
+  const bool stop = Monitor(TimeIter);
+
+  for (const auto& marker : preCICE_CouplingMarkers) {
+    const auto& vertices = GetMarkerPhysicalVertices(marker.Marker);
+    switch (marker.Write) {
+      case PRECICE_DATA::FORCE:
+        GetMarkerFlowLoads(marker.Marker, vertices, WriteData);
+        break;
+      case PRECICE_DATA::TEMPERATURE:
+        GetMarkerVertexTemperatures(marker.Marker, vertices, WriteData);
+        break;
+      case PRECICE_DATA::HEAT_FLUX:
+        GetMarkerVertexNormalHeatFluxes(marker.Marker, vertices, WriteData);
+        break;
+      default:
+        break;
+    }
+    WriteData += vertices.size() * marker.nWrite;
+  }
+
+  return stop;
+
+}
+
+// preCICE:
+bool CDriver::RunCouplingStep(unsigned long TimeIter, passivedouble deltaT, const vector<passivedouble>& ReadData) {
+
+  if (ReadData.size() != GetCouplingStepReadSize())
+    SU2_MPI::Error("Size of the read data buffer does not match the coupling markers.", CURRENT_FUNCTION);
+
+  preCICE_CouplingWriteData.resize(GetCouplingStepWriteSize());
+
+  return RunCouplingStep(TimeIter, deltaT, ReadData.data(), preCICE_CouplingWriteData.data());
+
+}
+
+// preCICE:
+const vector<passivedouble>& CDriver::GetCouplingStepWriteData() const {
+  return preCICE_CouplingWriteData;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Functions viewing the data without copy                                    */
+////////////////////////////////////////////////////////////////////////////////
+
+// preCICE:
+const passivedouble* CDriver::GetSolverSolutionData(string solver, unsigned long& nPoint, unsigned short& nVar) const {
+
+  unsigned short iSol = 0;
+  if (solver == "FLOW") iSol = FLOW_SOL;
+  else if (solver == "TURB") iSol = TURB_SOL;
+  else if (solver == "TRANS") iSol = TRANS_SOL;
+  else if (solver == "SPECIES") iSol = SPECIES_SOL;
+  else if (solver == "HEAT") iSol = HEAT_SOL;
+  else if (solver == "MESH") iSol = MESH_SOL;
+  else SU2_MPI::Error("Unknown solver " + solver + ".", CURRENT_FUNCTION);
+
+  CSolver* sol = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+  if (sol == nullptr) SU2_MPI::Error("Solver " + solver + " is not active.", CURRENT_FUNCTION);
+
+  nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  nVar = sol->GetnVar();
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Error("Views of the solution are not available in AD builds.", CURRENT_FUNCTION);
+  return nullptr;
+#else
+  return sol->GetNodes()->GetSolution().data();
+#endif
+}
+
+// preCICE:
+const passivedouble* CDriver::GetPrimitiveData(unsigned long& nPoint, unsigned short& nPrimVar) const {
+
+  CSolver* sol = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  nPrimVar = sol->GetnPrimVar();
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Error("Views of the primitive variables are not available in AD builds.", CURRENT_FUNCTION);
+  return nullptr;
+#else
+  /*--- The primitive variables of all points are one contiguous row-major block. ---*/
+  return sol->GetNodes()->GetPrimitive(0);
+#endif
+}
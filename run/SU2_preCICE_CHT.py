@@ -40,6 +40,17 @@ def main():
   
   # Dimension
   parser.add_option("-d", "--dimension", dest="nDim", help="Dimension of fluid domain (2D/3D)", type="int", default=2)
+
+  # Implicit coupling checkpoint
+  parser.add_option("--checkpoint-swap", action="store_true", dest="checkpoint_swap", help="Rewind the flow solution by swapping buffers instead of copying", default=False)
+  parser.add_option("--checkpoints", dest="nCheckpoint", help="Number of saved states (time windows) kept for rolling back", type="int", default=1)
+  parser.add_option("--checkpoint-single", dest="checkpoint_single", help="Comma-separated checkpoint fields stored in single precision, e.g. SOLUTION_TIME_N,SOLUTION_TIME_N1", default="")
+  parser.add_option("--checkpoint-compress", dest="checkpoint_compress", help="Comma-separated checkpoint fields stored losslessly compressed, e.g. SOLUTION_TIME_N1", default="")
+  parser.add_option("--checkpoint-multigrid", action="store_true", dest="checkpoint_multigrid", help="Save the coarse multigrid levels instead of restricting the solution on reload", default=False)
+  parser.add_option("--checkpoint-halo", action="store_true", dest="checkpoint_halo", help="Save the halo points as well instead of communicating them on reload", default=False)
+  parser.add_option("--checkpoint-async", action="store_true", dest="checkpoint_async", help="Save the state on a helper thread while the coupling data is read", default=False)
+  parser.add_option("--checkpoint-file", dest="checkpoint_file", help="Base name of the binary files every saved state is written to, one per rank", default="")
+  parser.add_option("--checkpoint-restore", action="store_true", dest="checkpoint_restore", help="Restart from the state in the files given by --checkpoint-file", default=False)
   
   (options, args) = parser.parse_args()
   options.nZone = int(1) # Specify number of zones here (1)
@@ -65,6 +76,22 @@ def main():
     return
 
 
+  # Checkpoint settings for implicit coupling
+  SU2Driver.SetCheckpointSwap(options.checkpoint_swap)
+  SU2Driver.SetnCheckpoint(options.nCheckpoint)
+  checkpoint_single = [field.strip() for field in options.checkpoint_single.split(",") if field.strip()]
+  for field in checkpoint_single:
+    SU2Driver.SetCheckpointSinglePrecision(field, True)
+  checkpoint_compress = [field.strip() for field in options.checkpoint_compress.split(",") if field.strip()]
+  for field in checkpoint_compress:
+    SU2Driver.SetCheckpointCompression(field, True)
+  SU2Driver.SetCheckpointMultigrid(options.checkpoint_multigrid)
+  SU2Driver.SetCheckpointHalo(options.checkpoint_halo)
+  if options.checkpoint_file:
+    SU2Driver.SetCheckpointFile(options.checkpoint_file)
+  if options.checkpoint_restore:
+    SU2Driver.RestoreCheckpointFile()
+
   # Configure preCICE:
   size = comm.Get_size()
   try:
@@ -103,20 +130,16 @@ def main():
   # If the CHT marker is defined on this rank:
   if CHTMarkerID != None:
     nVertex_CHTMarker = SU2Driver.GetNumberVertices(CHTMarkerID) #Total number of vertices on the marker
-    nVertex_CHTMarker_HALO = SU2Driver.GetNumberHaloVertices(CHTMarkerID)
-    nVertex_CHTMarker_PHYS = nVertex_CHTMarker - nVertex_CHTMarker_HALO
 
     # Obtain indices of all vertices that are being worked on on this rank
-    for iVertex in range(nVertex_CHTMarker):
-      if not SU2Driver.IsAHaloNode(CHTMarkerID, iVertex):
-        iVertices_CHTMarker_PHYS.append(int(iVertex))
+    iVertices_CHTMarker_PHYS = list(SU2Driver.GetMarkerPhysicalVertices(CHTMarkerID))
+    nVertex_CHTMarker_PHYS = len(iVertices_CHTMarker_PHYS)
+    nVertex_CHTMarker_HALO = nVertex_CHTMarker - nVertex_CHTMarker_PHYS
 
-  # Get coords of vertices
+  # Get coords of vertices, as a contiguous (nVertex_CHTMarker_PHYS x nDim) array for preCICE
   coords = numpy.zeros((nVertex_CHTMarker_PHYS, options.nDim))
-  for i, iVertex in enumerate(iVertices_CHTMarker_PHYS):
-    coord_passive = SU2Driver.GetInitialMeshCoord(CHTMarkerID, iVertex)
-    for iDim in range(options.nDim):
-      coords[i, iDim] = coord_passive[iDim]
+  if CHTMarkerID != None:
+    coords = numpy.array(SU2Driver.GetMarkerInitialCoordinates(CHTMarkerID)).reshape((nVertex_CHTMarker_PHYS, options.nDim))
 
   # Set mesh vertices in preCICE:
   try:
@@ -128,16 +151,16 @@ def main():
   # Get read and write data IDs
   precice_read = "Temperature"
   precice_write = "Heat-Flux"
-  GetFxn = SU2Driver.GetVertexNormalHeatFlux
-  SetFxn = SU2Driver.SetVertexTemperature
-  GetInitialFxn = SU2Driver.GetVertexTemperature
+  GetInitialFxn = SU2Driver.GetMarkerVertexTemperatures
   # Reverse coupling data read/write if -r flag included
   if options.precice_reverse:
     precice_read = "Heat-Flux"
     precice_write = "Temperature"
-    GetFxn = SU2Driver.GetVertexTemperature
-    SetFxn = SU2Driver.SetVertexNormalHeatFlux
-    GetInitialFxn = SU2Driver.GetVertexNormalHeatFlux
+    GetInitialFxn = SU2Driver.GetMarkerVertexNormalHeatFluxes
+
+  # The read data is set and the write data got on the marker by the single coupling step call of each iteration
+  if CHTMarkerID != None:
+    SU2Driver.AddCouplingStepMarker(CHTMarkerID, precice_read.upper().replace("-", "_"), precice_write.upper().replace("-", "_"))
 
   # Instantiate arrays to hold temperature + heat flux info
   read_data = numpy.zeros(nVertex_CHTMarker_PHYS)
@@ -147,13 +170,16 @@ def main():
   deltaT = SU2Driver.GetUnsteady_TimeStep()
   TimeIter = SU2Driver.GetTime_Iter()
   nTimeIter = SU2Driver.GetnTimeIter()
+  if options.checkpoint_restore:
+    # Continue from the time iteration of the restored state
+    TimeIter = SU2Driver.GetCheckpointTimeIter()
   time = TimeIter*deltaT
 
   # Set up initial data for preCICE
   if (participant.requires_initial_data()):
 
-    for i, iVertex in enumerate(iVertices_CHTMarker_PHYS):
-      write_data[i] = GetInitialFxn(CHTMarkerID, iVertex)
+    if CHTMarkerID != None:
+      write_data = numpy.array(GetInitialFxn(CHTMarkerID))
 
     participant.write_data(mesh_name, precice_write, vertex_ids, write_data)
 
@@ -174,11 +200,16 @@ def main():
 
   precice_saved_time = 0
   precice_saved_iter = 0
+  checkpoint_written = False
   while (participant.is_coupling_ongoing()):
     # Implicit coupling
     if (participant.requires_writing_checkpoint()):
-      # Save the state
-      SU2Driver.SaveOldState()
+      # Save the state, on a helper thread while the coupling data is read if requested
+      if options.checkpoint_async:
+        SU2Driver.StartSaveOldState(TimeIter)
+      else:
+        SU2Driver.SaveOldState(TimeIter)
+      checkpoint_written = True
       precice_saved_time = time
       precice_saved_iter = TimeIter
 
@@ -188,45 +219,32 @@ def main():
     # Retrieve data from preCICE
     read_data = participant.read_data(mesh_name, precice_read, vertex_ids, deltaT) 
 
-    # Set the updated values
-    for i, iVertex in enumerate(iVertices_CHTMarker_PHYS):
-        SetFxn(CHTMarkerID, iVertex, read_data[i])
-
-    # Tell the SU2 drive to update the boundary conditions
-    SU2Driver.BoundaryConditionsUpdate()
-
-    if options.with_MPI == True:
-      comm.Barrier()
-
     # Update timestep based on preCICE
     deltaT = SU2Driver.GetUnsteady_TimeStep()
     deltaT = min(precice_deltaT, deltaT)
-    SU2Driver.SetUnsteady_TimeStep(deltaT)
-
-    # Time iteration preprocessing
-    SU2Driver.Preprocess(TimeIter)
 
-    # Run one time iteration (e.g. dual-time)
-    SU2Driver.Run()
-
-    # Postprocess the solver and exit cleanly
-    SU2Driver.Postprocess()
-
-    # Update the solver for the next time iteration
-    SU2Driver.Update()
-    
-    # Monitor the solver
-    stopCalc = SU2Driver.Monitor(TimeIter)
+    # Set the read data and update the boundary conditions, run one time iteration (preprocess, run, postprocess, update, monitor)
+    # and get the write data in a single call. It also waits for the state saved on a helper thread and restores the checkpoint
+    # buffer swapped out by the last reload.
+    stopCalc = SU2Driver.RunCouplingStep(TimeIter, deltaT, read_data)
+    if CHTMarkerID != None:
+      write_data = numpy.asarray(SU2Driver.GetCouplingStepWriteView())
+
+    if checkpoint_written:
+      for field in checkpoint_single:
+        error = SU2Driver.GetCheckpointRoundTripError(field)
+        if rank == 0:
+          print("Checkpoint field {} stored in single precision, maximum round-trip error: {:e}".format(field, error))
+      for field in checkpoint_compress:
+        ratio = SU2Driver.GetCheckpointCompressionRatio(field)
+        if rank == 0:
+          print("Checkpoint field {} stored compressed, compression ratio: {:.2f}".format(field, ratio))
+    checkpoint_written = False
 
     # Update control parameters
     TimeIter += 1
     time += deltaT
 
-    # Loop over the vertices
-    for i, iVertex in enumerate(iVertices_CHTMarker_PHYS):
-      # Get heat fluxes at each vertex
-      write_data[i] = GetFxn(CHTMarkerID, iVertex)
-      
     # Write data to preCICE
     participant.write_data(mesh_name, precice_write, vertex_ids, write_data)
 
@@ -39,6 +39,20 @@ def main():
 
     # Dimension
     parser.add_option("-d", "--dimension", dest="nDim", help="Dimension of fluid domain (2D/3D)", type="int", default=2)
+
+    # Implicit coupling checkpoint
+    parser.add_option("--checkpoint-swap", action="store_true", dest="checkpoint_swap", help="Rewind the flow solution by swapping buffers instead of copying", default=False)
+    parser.add_option("--checkpoints", dest="nCheckpoint", help="Number of saved states (time windows) kept for rolling back", type="int", default=1)
+    parser.add_option("--checkpoint-single", dest="checkpoint_single", help="Comma-separated checkpoint fields stored in single precision, e.g. SOLUTION_TIME_N,SOLUTION_TIME_N1", default="")
+    parser.add_option("--checkpoint-compress", dest="checkpoint_compress", help="Comma-separated checkpoint fields stored losslessly compressed, e.g. SOLUTION_TIME_N1", default="")
+    parser.add_option("--checkpoint-multigrid", action="store_true", dest="checkpoint_multigrid", help="Save the coarse multigrid levels instead of restricting the solution on reload", default=False)
+    parser.add_option("--checkpoint-halo", action="store_true", dest="checkpoint_halo", help="Save the halo points as well instead of communicating them on reload", default=False)
+    parser.add_option("--checkpoint-async", action="store_true", dest="checkpoint_async", help="Save the state on a helper thread while the coupling data is read", default=False)
+    parser.add_option("--checkpoint-file", dest="checkpoint_file", help="Base name of the binary files every saved state is written to, one per rank", default="")
+    parser.add_option("--checkpoint-restore", action="store_true", dest="checkpoint_restore", help="Restart from the state in the files given by --checkpoint-file", default=False)
+    parser.add_option("--checkpoint-minimal", action="store_true", dest="checkpoint_minimal", help="Derive mesh coordinates, grid velocity and volume on reload instead of saving them", default=False)
+    parser.add_option("--checkpoint-verify", action="store_true", dest="checkpoint_verify", help="With --checkpoint-minimal, compare the derived fields with saved ones on reload", default=False)
+    parser.add_option("--checkpoint-metrics", action="store_true", dest="checkpoint_metrics", help="Save the dual-grid metrics instead of rebuilding them from the coordinates on reload", default=False)
   
     (options, args) = parser.parse_args()
     options.nZone = int(1)
@@ -63,6 +77,24 @@ def main():
             print('ERROR : You are trying to launch a computation without initializing MPI but the wrapper has been built in parallel. Please add the --parallel option in order to initialize MPI for the wrapper.')
         return
 
+    # Checkpoint settings for implicit coupling
+    SU2Driver.SetCheckpointSwap(options.checkpoint_swap)
+    SU2Driver.SetnCheckpoint(options.nCheckpoint)
+    checkpoint_single = [field.strip() for field in options.checkpoint_single.split(",") if field.strip()]
+    for field in checkpoint_single:
+        SU2Driver.SetCheckpointSinglePrecision(field, True)
+    checkpoint_compress = [field.strip() for field in options.checkpoint_compress.split(",") if field.strip()]
+    for field in checkpoint_compress:
+        SU2Driver.SetCheckpointCompression(field, True)
+    SU2Driver.SetCheckpointMultigrid(options.checkpoint_multigrid)
+    SU2Driver.SetCheckpointHalo(options.checkpoint_halo)
+    SU2Driver.SetCheckpointMinimal(options.checkpoint_minimal, options.checkpoint_verify)
+    SU2Driver.SetCheckpointGeometryMetrics(options.checkpoint_metrics)
+    if options.checkpoint_file:
+        SU2Driver.SetCheckpointFile(options.checkpoint_file)
+    if options.checkpoint_restore:
+        SU2Driver.RestoreCheckpointFile()
+
     # Configure preCICE:
     size = comm.Get_size()
     try:
@@ -100,23 +132,16 @@ def main():
     
     if MovingMarkerID != None:
         nVertex_MovingMarker = SU2Driver.GetNumberVertices(MovingMarkerID)
-        nVertex_MovingMarker_HALO = SU2Driver.GetNumberHaloVertices(MovingMarkerID)
-        nVertex_MovingMarker_PHYS = nVertex_MovingMarker - nVertex_MovingMarker_HALO
-        
+
         # Obtain indices of all vertices that are being worked on on this rank
-        for iVertex in range(nVertex_MovingMarker):
-            if not SU2Driver.IsAHaloNode(MovingMarkerID, iVertex):
-                iVertices_MovingMarker_PHYS.append(int(iVertex))
+        iVertices_MovingMarker_PHYS = list(SU2Driver.GetMarkerPhysicalVertices(MovingMarkerID))
+        nVertex_MovingMarker_PHYS = len(iVertices_MovingMarker_PHYS)
+        nVertex_MovingMarker_HALO = nVertex_MovingMarker - nVertex_MovingMarker_PHYS
     
-    # Get coords of vertices
+    # Get coords of vertices, as a contiguous (nVertex_MovingMarker_PHYS x nDim) array for preCICE
     coords = numpy.zeros((nVertex_MovingMarker_PHYS, options.nDim))
-    for i, iVertex in enumerate(iVertices_MovingMarker_PHYS):
-        coord_passive = SU2Driver.GetInitialMeshCoord(MovingMarkerID, iVertex)
-        for iDim in range(options.nDim):
-            coords[i, iDim] = coord_passive[iDim]
-
-    # Set mesh vertices in preCICE:
-    vertex_ids = participant.set_mesh_vertices(mesh_name, coords)
+    if MovingMarkerID != None:
+        coords = numpy.array(SU2Driver.GetMarkerInitialCoordinates(MovingMarkerID)).reshape((nVertex_MovingMarker_PHYS, options.nDim))
 
     # Set mesh vertices in preCICE:
     try:
@@ -130,6 +155,10 @@ def main():
     precice_read = "Displacement"
     precice_write = "Force"
 
+    # Displacements are set and forces got on the marker by the single coupling step call of each iteration
+    if MovingMarkerID != None:
+        SU2Driver.AddCouplingStepMarker(MovingMarkerID, "DISPLACEMENT", "FORCE")
+
     # Instantiate arrays to hold displacements + forces info
     displacements = numpy.zeros((nVertex_MovingMarker_PHYS,options.nDim))
     forces = numpy.zeros((nVertex_MovingMarker_PHYS,options.nDim))
@@ -138,13 +167,16 @@ def main():
     deltaT = SU2Driver.GetUnsteady_TimeStep()
     TimeIter = SU2Driver.GetTime_Iter()
     nTimeIter = SU2Driver.GetnTimeIter()
+    if options.checkpoint_restore:
+        # Continue from the time iteration of the restored state
+        TimeIter = SU2Driver.GetCheckpointTimeIter()
     time = TimeIter*deltaT
 
     # Set up initial data for preCICE
     if (participant.requires_initial_data()):
 
-        for i, iVertex in enumerate(iVertices_MovingMarker_PHYS):
-            forces[i] = SU2Driver.GetFlowLoad(MovingMarkerID, iVertex)[:-1]
+        if MovingMarkerID != None:
+            forces = numpy.array(SU2Driver.GetMarkerFlowLoads(MovingMarkerID)).reshape((nVertex_MovingMarker_PHYS, options.nDim))
 
         participant.write_block_vector_data(mesh_name, precice_write, vertex_ids, forces)
 
@@ -165,12 +197,17 @@ def main():
 
     precice_saved_time = 0
     precice_saved_iter = 0
+    checkpoint_written = False
     while (participant.is_coupling_ongoing()):#(TimeIter < nTimeIter):
         
         # Implicit coupling
         if (participant.requires_writing_checkpoint()):
-            # Save the state
-            SU2Driver.SaveOldState()
+            # Save the state, on a helper thread while the coupling data is read if requested
+            if options.checkpoint_async:
+                SU2Driver.StartSaveOldState(TimeIter)
+            else:
+                SU2Driver.SaveOldState(TimeIter)
+            checkpoint_written = True
             precice_saved_time = time
             precice_saved_iter = TimeIter
 
@@ -179,47 +216,32 @@ def main():
 
         # Retreive data from preCICE
         displacements = participant.read_data(mesh_name, precice_read, vertex_ids, deltaT)
-        
-        # Set the updated displacements
-        for i, iVertex in enumerate(iVertices_MovingMarker_PHYS):
-            DisplX = displacements[i][0]
-            DisplY = displacements[i][1]
-            DisplZ = 0 if options.nDim == 2 else displacements[i][2]
 
-            SU2Driver.SetMeshDisplacement(MovingMarkerID, iVertex, DisplX, DisplY, DisplZ)
-        
-        if options.with_MPI == True:
-            comm.Barrier()
-            
         # Update timestep based on preCICE
         deltaT = SU2Driver.GetUnsteady_TimeStep()
         deltaT = min(precice_deltaT, deltaT)
-        SU2Driver.SetUnsteady_TimeStep(deltaT)
-        
-        # Time iteration preprocessing (mesh is deformed here)
-        SU2Driver.Preprocess(TimeIter)
 
-        # Run one time iteration (e.g. dual-time)
-        SU2Driver.Run()
-
-        # Postprocess the solver
-        SU2Driver.Postprocess()
-
-        # Update the solver for the next time iteration
-        SU2Driver.Update()
-
-        # Monitor the solver
-        stopCalc = SU2Driver.Monitor(TimeIter)
+        # Set the displacements, run one time iteration (preprocess, run, postprocess, update, monitor) and get the forces in a single call.
+        # It also waits for the state saved on a helper thread and restores the checkpoint buffer swapped out by the last reload.
+        stopCalc = SU2Driver.RunCouplingStep(TimeIter, deltaT, displacements.flatten())
+        if MovingMarkerID != None:
+            forces = numpy.asarray(SU2Driver.GetCouplingStepWriteView()).reshape((nVertex_MovingMarker_PHYS, options.nDim))
+
+        if checkpoint_written:
+            for field in checkpoint_single:
+                error = SU2Driver.GetCheckpointRoundTripError(field)
+                if rank == 0:
+                    print("Checkpoint field {} stored in single precision, maximum round-trip error: {:e}".format(field, error))
+            for field in checkpoint_compress:
+                ratio = SU2Driver.GetCheckpointCompressionRatio(field)
+                if rank == 0:
+                    print("Checkpoint field {} stored compressed, compression ratio: {:.2f}".format(field, ratio))
+        checkpoint_written = False
 
         # Update control parameters
         TimeIter += 1
         time += deltaT
 
-        # Loop over the vertices
-        for i, iVertex in enumerate(iVertices_MovingMarker_PHYS):
-            # Get forces at each vertex
-            forces[i] = SU2Driver.GetFlowLoad(MovingMarkerID, iVertex)[:-1]
-
         # Write data to preCICE
         participant.write_data(mesh_name, precice_write, vertex_ids, forces)
 
@@ -230,6 +252,14 @@ def main():
         if (participant.requires_reading_checkpoint()):
             # Reload old state
             SU2Driver.ReloadOldState()
+            if options.checkpoint_minimal and options.checkpoint_verify:
+                error = SU2Driver.GetCheckpointVerificationError()
+                if rank == 0:
+                    print("Derived checkpoint fields, maximum difference of coordinates: {:e}, volumes: {:e}".format(error[0], error[1]))
+            if options.checkpoint_metrics:
+                geometry_time = SU2Driver.GetCheckpointGeometryTime()
+                if rank == 0 and geometry_time[0] > 0.0:
+                    print("Saved geometry metrics restored in {:.3e} s instead of {:.3e} s for the rebuild".format(geometry_time[0], geometry_time[1]))
             time = precice_saved_time
             TimeIter = precice_saved_iter
 